@@ -0,0 +1,63 @@
+#pragma once
+
+#include <OpenLoco/Diagnostics/LogSink.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // Hands messages over to a background thread that prints them to the target sink, so the
+    // caller never waits on the terminal or the disk. Adding a message never takes a lock, when
+    // the queue is full the message is dropped and a warning with the number of dropped messages
+    // is printed once the writer has caught up.
+    class LogQueue final : public LogSink
+    {
+    public:
+        static constexpr size_t kDefaultCapacity = 4096;
+
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> sequence;
+            Level level;
+            int intendSize;
+            std::string message;
+        };
+
+        std::shared_ptr<LogSink> _target;
+        std::unique_ptr<Slot[]> _slots;
+        size_t _mask{};
+        std::atomic<size_t> _enqueuePos{};
+        std::atomic<size_t> _dequeuePos{};
+        std::atomic<size_t> _dropped{};
+        std::atomic<uint32_t> _signal{};
+        std::atomic<bool> _quit{};
+        std::thread _thread;
+
+        bool tryPrintNext();
+        bool hasPrinted(size_t pos) const;
+        void run();
+
+    public:
+        // Capacity is rounded up to a power of two.
+        LogQueue(std::shared_ptr<LogSink> target, size_t capacity = kDefaultCapacity);
+        LogQueue(const LogQueue&) = delete;
+        LogQueue& operator=(const LogQueue&) = delete;
+        // Prints everything still queued before returning.
+        ~LogQueue() override;
+
+        void print(Level level, std::string_view message) override;
+
+        // Waits until every message queued before the call has been printed.
+        void flush() override;
+        // Polls rather than waits as there is no timed wait on atomics, for when the writer might
+        // never catch up such as a crash.
+        bool flush(std::chrono::milliseconds timeout) override;
+
+        size_t getCapacity() const noexcept;
+    };
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <OpenLoco/Diagnostics/LogLevel.h>
+#include <chrono>
 #include <fmt/format.h>
 #include <string_view>
 
@@ -13,6 +14,15 @@ namespace OpenLoco::Diagnostics::Logging
 
         virtual void print(Level level, std::string_view message) = 0;
 
+        // Sinks that print later than they are given a message wait here until they are done.
+        virtual void flush() {}
+
+        // As flush but gives up after timeout, returns false if anything was left unprinted.
+        virtual bool flush([[maybe_unused]] std::chrono::milliseconds timeout)
+        {
+            return true;
+        }
+
         template<typename... TArgs>
         void info(fmt::format_string<TArgs...> fmt, TArgs&&... args)
         {
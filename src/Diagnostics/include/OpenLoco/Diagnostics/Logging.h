@@ -1,6 +1,7 @@
 #pragma once
 
 #include <OpenLoco/Diagnostics/LogLevel.h>
+#include <chrono>
 #include <fmt/format.h>
 // Enable printing of fs::path
 #include <fmt/std.h>
@@ -65,6 +66,13 @@ namespace OpenLoco::Diagnostics::Logging
 
     void disableLevel(Level level);
 
+    // Waits until every sink has printed all messages given so far, e.g. before a crash dump.
+    void flush();
+
+    // As flush but waits at most timeout for all sinks together, for the crash handler where the
+    // writer may be stuck. Returns false if anything was left unprinted.
+    bool flush(std::chrono::milliseconds timeout);
+
     void installSink(std::shared_ptr<LogSink> sink);
 
     void removeSink(std::shared_ptr<LogSink> sink);
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <iosfwd>
+#include <string_view>
+#include <vector>
+
+namespace OpenLoco::Diagnostics::Profiling
+{
+    using ClockType = std::chrono::steady_clock;
+
+    // Time spent in all zones with the same name and nesting depth during one frame
+    struct ZoneSummary
+    {
+        std::string_view name;
+        uint32_t depth;
+        uint32_t calls;
+        float milliseconds;
+    };
+
+    namespace Detail
+    {
+        // Returns the nesting depth of the new zone
+        uint32_t beginZone();
+        void endZone(const char* name, uint32_t depth, ClockType::time_point start, ClockType::time_point end);
+    }
+
+    // Zones are only recorded while enabled, otherwise they cost a single flag check.
+    void setEnabled(bool enabled);
+    bool isEnabled();
+
+    // Completes the current frame, making its zones available from getLastFrame.
+    void endFrame();
+
+    // Zones of the last completed frame in the order they were first entered.
+    const std::vector<ZoneSummary>& getLastFrame();
+    float getLastFrameDuration();
+
+    // Records every zone until endCapture which writes them out as Chrome trace event JSON
+    // (viewable in chrome://tracing or Perfetto). Capturing enables the profiler.
+    void beginCapture();
+    bool isCapturing();
+    void endCapture(std::ostream& output);
+
+    class ScopedZone
+    {
+    private:
+        const char* _name;
+        uint32_t _depth{};
+        ClockType::time_point _start;
+        bool _active;
+
+    public:
+        // The name must have static storage duration as only the pointer is kept
+        explicit ScopedZone(const char* name)
+            : _name(name)
+            , _active(isEnabled())
+        {
+            if (_active)
+            {
+                _depth = Detail::beginZone();
+                _start = ClockType::now();
+            }
+        }
+
+        ~ScopedZone()
+        {
+            if (_active)
+            {
+                Detail::endZone(_name, _depth, _start, ClockType::now());
+            }
+        }
+
+        ScopedZone(const ScopedZone&) = delete;
+        ScopedZone& operator=(const ScopedZone&) = delete;
+    };
+}
+
+#define OPENLOCO_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OPENLOCO_PROFILE_CONCAT(a, b) OPENLOCO_PROFILE_CONCAT_IMPL(a, b)
+#define OPENLOCO_PROFILE_SCOPE(name) const ::OpenLoco::Diagnostics::Profiling::ScopedZone OPENLOCO_PROFILE_CONCAT(_profileZone, __LINE__)(name)
@@ -0,0 +1,167 @@
+#include "OpenLoco/Diagnostics/LogQueue.h"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <fmt/format.h>
+
+namespace OpenLoco::Diagnostics::Logging
+{
+    // Bounded queue after Dmitry Vyukov's, every slot carries a sequence number telling whether it
+    // is free for the producer holding a position or ready for the writer. The message strings stay
+    // in their slots so their buffers are reused instead of allocated for every message.
+    LogQueue::LogQueue(std::shared_ptr<LogSink> target, size_t capacity)
+        : _target(std::move(target))
+    {
+        capacity = std::bit_ceil(std::max<size_t>(capacity, 2));
+        _slots = std::make_unique<Slot[]>(capacity);
+        _mask = capacity - 1;
+        for (size_t i = 0; i < capacity; i++)
+        {
+            _slots[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        _thread = std::thread([this] { run(); });
+    }
+
+    LogQueue::~LogQueue()
+    {
+        _quit.store(true, std::memory_order_release);
+        _signal.fetch_add(1, std::memory_order_release);
+        _signal.notify_one();
+        _thread.join();
+    }
+
+    void LogQueue::print(Level level, std::string_view message)
+    {
+        if (!passesLevelFilter(level))
+        {
+            return;
+        }
+
+        auto pos = _enqueuePos.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        while (true)
+        {
+            slot = &_slots[pos & _mask];
+            const auto sequence = slot->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    break;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Still held by the writer from the previous lap, the queue is full
+                _dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            else
+            {
+                pos = _enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->level = level;
+        slot->intendSize = getIntendSize();
+        slot->message.assign(message);
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        _signal.fetch_add(1, std::memory_order_release);
+        _signal.notify_one();
+    }
+
+    bool LogQueue::tryPrintNext()
+    {
+        const auto pos = _dequeuePos.load(std::memory_order_relaxed);
+        auto& slot = _slots[pos & _mask];
+        const auto sequence = slot.sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos + 1) < 0)
+        {
+            return false;
+        }
+
+        _target->setIntendSize(slot.intendSize);
+        _target->print(slot.level, slot.message);
+
+        // Hand the slot back for the next lap
+        slot.sequence.store(pos + _mask + 1, std::memory_order_release);
+        _dequeuePos.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    void LogQueue::run()
+    {
+        while (true)
+        {
+            const auto signal = _signal.load(std::memory_order_acquire);
+
+            bool printedAny = false;
+            while (tryPrintNext())
+            {
+                printedAny = true;
+            }
+
+            // Only reported once caught up so it follows everything that made it into the queue
+            const auto dropped = _dropped.exchange(0, std::memory_order_relaxed);
+            if (dropped != 0)
+            {
+                _target->setIntendSize(0);
+                _target->print(Level::warning, fmt::format("{} log messages were dropped, the log queue was full", dropped));
+            }
+
+            if (printedAny || dropped != 0)
+            {
+                _dequeuePos.notify_all();
+                continue;
+            }
+
+            if (_quit.load(std::memory_order_acquire))
+            {
+                return;
+            }
+            _signal.wait(signal, std::memory_order_acquire);
+        }
+    }
+
+    bool LogQueue::hasPrinted(size_t pos) const
+    {
+        return static_cast<intptr_t>(_dequeuePos.load(std::memory_order_acquire)) - static_cast<intptr_t>(pos) >= 0;
+    }
+
+    void LogQueue::flush()
+    {
+        const auto target = _enqueuePos.load(std::memory_order_acquire);
+        while (true)
+        {
+            const auto pos = _dequeuePos.load(std::memory_order_acquire);
+            if (static_cast<intptr_t>(pos) - static_cast<intptr_t>(target) >= 0)
+            {
+                return;
+            }
+            _dequeuePos.wait(pos, std::memory_order_acquire);
+        }
+    }
+
+    bool LogQueue::flush(std::chrono::milliseconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        const auto target = _enqueuePos.load(std::memory_order_acquire);
+        while (!hasPrinted(target))
+        {
+            if (std::chrono::steady_clock::now() >= deadline)
+            {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+
+    size_t LogQueue::getCapacity() const noexcept
+    {
+        return _mask + 1;
+    }
+}
@@ -50,6 +50,26 @@ namespace OpenLoco::Diagnostics::Logging
 
     }
 
+    void flush()
+    {
+        for (auto& sink : _sinks)
+        {
+            sink->flush();
+        }
+    }
+
+    bool flush(std::chrono::milliseconds timeout)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + timeout;
+        bool flushed = true;
+        for (auto& sink : _sinks)
+        {
+            const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(deadline - std::chrono::steady_clock::now());
+            flushed &= sink->flush(std::max(remaining, std::chrono::milliseconds(0)));
+        }
+        return flushed;
+    }
+
     void installSink(std::shared_ptr<LogSink> sink)
     {
         _sinks.push_back(sink);
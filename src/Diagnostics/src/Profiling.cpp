@@ -0,0 +1,191 @@
+#include "Profiling.h"
+#include <algorithm>
+#include <atomic>
+#include <fmt/format.h>
+#include <iterator>
+#include <mutex>
+#include <ostream>
+#include <string>
+
+namespace OpenLoco::Diagnostics::Profiling
+{
+    struct ZoneRecord
+    {
+        const char* name;
+        uint32_t depth;
+        ClockType::time_point start;
+        ClockType::duration duration;
+    };
+
+    struct TraceEvent
+    {
+        const char* name;
+        uint32_t threadId;
+        ClockType::time_point start;
+        ClockType::duration duration;
+    };
+
+    // Bounds memory if a frame is never ended or a capture is left running.
+    static constexpr size_t kMaxFrameRecords = 100'000;
+    static constexpr size_t kMaxCaptureEvents = 2'000'000;
+
+    static std::atomic<bool> _enabled{};
+    static std::atomic<bool> _capturing{};
+    static std::atomic<uint32_t> _nextThreadId{};
+
+    static std::mutex _mutex;
+    static std::vector<ZoneRecord> _currentFrame;
+    static std::vector<ZoneSummary> _lastFrame;
+    static float _lastFrameDuration{};
+    static ClockType::time_point _frameStart = ClockType::now();
+    static ClockType::time_point _captureStart;
+    static std::vector<TraceEvent> _captureEvents;
+
+    static thread_local uint32_t _depth{};
+    static thread_local uint32_t _threadId = ++_nextThreadId;
+
+    namespace Detail
+    {
+        uint32_t beginZone()
+        {
+            return _depth++;
+        }
+
+        void endZone(const char* name, uint32_t depth, ClockType::time_point start, ClockType::time_point end)
+        {
+            // Restoring rather than decrementing keeps the depth correct when an inner zone
+            // never ended (e.g. jumped over by the tick longjmp).
+            _depth = depth;
+
+            std::lock_guard lock(_mutex);
+            if (_currentFrame.size() < kMaxFrameRecords)
+            {
+                _currentFrame.push_back(ZoneRecord{ name, depth, start, end - start });
+            }
+            if (_capturing && _captureEvents.size() < kMaxCaptureEvents)
+            {
+                _captureEvents.push_back(TraceEvent{ name, _threadId, start, end - start });
+            }
+        }
+    }
+
+    void setEnabled(bool enabled)
+    {
+        _enabled = enabled;
+    }
+
+    bool isEnabled()
+    {
+        return _enabled || _capturing;
+    }
+
+    void endFrame()
+    {
+        const auto now = ClockType::now();
+
+        std::lock_guard lock(_mutex);
+
+        // Zones are recorded as they end so children come before their parents,
+        // sort by start time to get them back into the order they were entered.
+        std::stable_sort(_currentFrame.begin(), _currentFrame.end(), [](const ZoneRecord& lhs, const ZoneRecord& rhs) {
+            return lhs.start < rhs.start;
+        });
+
+        _lastFrame.clear();
+        for (const auto& record : _currentFrame)
+        {
+            const auto name = std::string_view(record.name);
+            auto it = std::find_if(_lastFrame.begin(), _lastFrame.end(), [&](const ZoneSummary& summary) {
+                return summary.depth == record.depth && summary.name == name;
+            });
+            if (it == _lastFrame.end())
+            {
+                it = _lastFrame.insert(_lastFrame.end(), ZoneSummary{ name, record.depth, 0, 0.0f });
+            }
+            it->calls++;
+            it->milliseconds += std::chrono::duration<float, std::milli>(record.duration).count();
+        }
+        _currentFrame.clear();
+
+        _lastFrameDuration = std::chrono::duration<float, std::milli>(now - _frameStart).count();
+        _frameStart = now;
+    }
+
+    const std::vector<ZoneSummary>& getLastFrame()
+    {
+        return _lastFrame;
+    }
+
+    float getLastFrameDuration()
+    {
+        return _lastFrameDuration;
+    }
+
+    void beginCapture()
+    {
+        std::lock_guard lock(_mutex);
+        _captureEvents.clear();
+        _captureStart = ClockType::now();
+        _capturing = true;
+    }
+
+    bool isCapturing()
+    {
+        return _capturing;
+    }
+
+    static void appendEscaped(std::string& buffer, std::string_view text)
+    {
+        for (const auto chr : text)
+        {
+            switch (chr)
+            {
+                case '"':
+                    buffer += "\\\"";
+                    break;
+                case '\\':
+                    buffer += "\\\\";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(chr) < 0x20)
+                    {
+                        fmt::format_to(std::back_inserter(buffer), "\\u{:04x}", static_cast<int>(chr));
+                    }
+                    else
+                    {
+                        buffer += chr;
+                    }
+                    break;
+            }
+        }
+    }
+
+    void endCapture(std::ostream& output)
+    {
+        std::vector<TraceEvent> events;
+        ClockType::time_point captureStart;
+        {
+            std::lock_guard lock(_mutex);
+            _capturing = false;
+            events.swap(_captureEvents);
+            captureStart = _captureStart;
+        }
+
+        // Complete ("X") events with timestamps in microseconds relative to the capture start
+        std::string buffer = "{\"traceEvents\":[";
+        for (size_t i = 0; i < events.size(); i++)
+        {
+            const auto& event = events[i];
+            const auto start = std::chrono::duration<double, std::micro>(event.start - captureStart).count();
+            const auto duration = std::chrono::duration<double, std::micro>(event.duration).count();
+
+            buffer += i == 0 ? "\n" : ",\n";
+            buffer += "{\"name\":\"";
+            appendEscaped(buffer, event.name);
+            fmt::format_to(std::back_inserter(buffer), "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":{:.3f},\"dur\":{:.3f}}}", event.threadId, start, duration);
+        }
+        buffer += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        output.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+}
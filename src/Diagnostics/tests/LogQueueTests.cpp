@@ -0,0 +1,180 @@
+#include <OpenLoco/Diagnostics/LogQueue.h>
+#include <OpenLoco/Diagnostics/LogSink.h>
+#include <condition_variable>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Diagnostics;
+
+class TestRecordingSink : public Logging::LogSink
+{
+    std::mutex _mutex;
+    std::condition_variable _released;
+    std::vector<std::string> _messages;
+    bool _blocked = false;
+
+public:
+    void print(Logging::Level, std::string_view msg) override
+    {
+        std::unique_lock lock(_mutex);
+        _released.wait(lock, [this] { return !_blocked; });
+        _messages.emplace_back(msg);
+    }
+
+    void block()
+    {
+        std::lock_guard lock(_mutex);
+        _blocked = true;
+    }
+
+    void release()
+    {
+        {
+            std::lock_guard lock(_mutex);
+            _blocked = false;
+        }
+        _released.notify_all();
+    }
+
+    std::vector<std::string> getMessages()
+    {
+        std::lock_guard lock(_mutex);
+        return _messages;
+    }
+};
+
+TEST(LogQueueTests, FlushPrintsEverythingQueued)
+{
+    auto target = std::make_shared<TestRecordingSink>();
+    Logging::LogQueue queue(target);
+
+    queue.info("First");
+    queue.warn("Second {}", 2);
+    queue.flush();
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), 2);
+    ASSERT_EQ(messages[0], "First");
+    ASSERT_EQ(messages[1], "Second 2");
+}
+
+TEST(LogQueueTests, FlushWithTimeoutGivesUpOnStuckWriter)
+{
+    using namespace std::chrono_literals;
+
+    auto target = std::make_shared<TestRecordingSink>();
+    Logging::LogQueue queue(target);
+
+    target->block();
+    queue.info("Stuck");
+    ASSERT_FALSE(queue.flush(10ms));
+
+    target->release();
+    ASSERT_TRUE(queue.flush(10s));
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), 1);
+    ASSERT_EQ(messages[0], "Stuck");
+}
+
+TEST(LogQueueTests, DestructorDrainsQueue)
+{
+    auto target = std::make_shared<TestRecordingSink>();
+    {
+        Logging::LogQueue queue(target);
+        for (int i = 0; i < 100; i++)
+        {
+            queue.info("{}", i);
+        }
+    }
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), 100);
+    for (int i = 0; i < 100; i++)
+    {
+        ASSERT_EQ(messages[i], std::to_string(i));
+    }
+}
+
+TEST(LogQueueTests, KeepsOrderOfEachThread)
+{
+    constexpr int kNumThreads = 4;
+    constexpr int kNumMessages = 1000;
+
+    auto target = std::make_shared<TestRecordingSink>();
+    Logging::LogQueue queue(target, kNumThreads * kNumMessages);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < kNumThreads; t++)
+    {
+        threads.emplace_back([&queue, t] {
+            for (int i = 0; i < kNumMessages; i++)
+            {
+                queue.info("{} {}", t, i);
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    queue.flush();
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), kNumThreads * kNumMessages);
+
+    std::vector<int> next(kNumThreads, 0);
+    for (const auto& message : messages)
+    {
+        const auto space = message.find(' ');
+        const auto t = std::stoi(message.substr(0, space));
+        const auto i = std::stoi(message.substr(space + 1));
+        ASSERT_EQ(i, next[t]);
+        next[t]++;
+    }
+}
+
+TEST(LogQueueTests, OverflowDropsNewestMessages)
+{
+    auto target = std::make_shared<TestRecordingSink>();
+    {
+        Logging::LogQueue queue(target, 4);
+        ASSERT_EQ(queue.getCapacity(), 4);
+
+        // The writer holds on to the slot of the message it is printing, so with it stuck on the
+        // first message exactly four fit no matter how far it got.
+        target->block();
+        for (int i = 0; i < 6; i++)
+        {
+            queue.info("{}", i);
+        }
+        target->release();
+    }
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), 5);
+    ASSERT_EQ(messages[0], "0");
+    ASSERT_EQ(messages[1], "1");
+    ASSERT_EQ(messages[2], "2");
+    ASSERT_EQ(messages[3], "3");
+    ASSERT_EQ(messages[4], "2 log messages were dropped, the log queue was full");
+}
+
+TEST(LogQueueTests, LevelFilter)
+{
+    auto target = std::make_shared<TestRecordingSink>();
+    Logging::LogQueue queue(target);
+    queue.disableLevel(Logging::Level::verbose);
+
+    queue.verbose("Hidden");
+    queue.info("Shown");
+    queue.flush();
+
+    const auto messages = target->getMessages();
+    ASSERT_EQ(messages.size(), 1);
+    ASSERT_EQ(messages[0], "Shown");
+}
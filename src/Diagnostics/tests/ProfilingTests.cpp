@@ -0,0 +1,69 @@
+#include <OpenLoco/Diagnostics/Profiling.h>
+#include <gtest/gtest.h>
+#include <sstream>
+
+using namespace OpenLoco;
+using namespace OpenLoco::Diagnostics;
+
+TEST(ProfilingTests, DisabledRecordsNothing)
+{
+    Profiling::setEnabled(false);
+    {
+        OPENLOCO_PROFILE_SCOPE("disabled");
+    }
+    Profiling::endFrame();
+
+    ASSERT_TRUE(Profiling::getLastFrame().empty());
+}
+
+TEST(ProfilingTests, FrameSummary)
+{
+    Profiling::setEnabled(true);
+    {
+        OPENLOCO_PROFILE_SCOPE("outer");
+        for (auto i = 0; i < 3; i++)
+        {
+            OPENLOCO_PROFILE_SCOPE("inner");
+        }
+    }
+    Profiling::endFrame();
+    Profiling::setEnabled(false);
+
+    const auto& frame = Profiling::getLastFrame();
+    ASSERT_EQ(frame.size(), 2);
+
+    ASSERT_EQ(frame[0].name, "outer");
+    ASSERT_EQ(frame[0].depth, 0);
+    ASSERT_EQ(frame[0].calls, 1);
+
+    ASSERT_EQ(frame[1].name, "inner");
+    ASSERT_EQ(frame[1].depth, 1);
+    ASSERT_EQ(frame[1].calls, 3);
+    ASSERT_LE(frame[1].milliseconds, frame[0].milliseconds);
+
+    // The next frame starts empty
+    Profiling::endFrame();
+    ASSERT_TRUE(Profiling::getLastFrame().empty());
+}
+
+TEST(ProfilingTests, ChromeTraceCapture)
+{
+    Profiling::setEnabled(false);
+    Profiling::beginCapture();
+    ASSERT_TRUE(Profiling::isEnabled());
+    {
+        OPENLOCO_PROFILE_SCOPE("captured \"zone\"");
+    }
+
+    std::ostringstream output;
+    Profiling::endCapture(output);
+    Profiling::endFrame();
+
+    ASSERT_FALSE(Profiling::isCapturing());
+    ASSERT_FALSE(Profiling::isEnabled());
+
+    const auto json = output.str();
+    ASSERT_EQ(json.rfind("{\"traceEvents\":[", 0), 0);
+    ASSERT_NE(json.find("\"name\":\"captured \\\"zone\\\"\""), std::string::npos);
+    ASSERT_NE(json.find("\"ph\":\"X\""), std::string::npos);
+}
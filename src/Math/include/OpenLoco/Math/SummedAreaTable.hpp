@@ -0,0 +1,64 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace OpenLoco::Math
+{
+    // Sum of any rectangle of a grid of values in constant time, after a single pass over the grid
+    // to build it. The table does not follow changes to the grid, it has to be built again.
+    template<typename T>
+    class SummedAreaTable
+    {
+    private:
+        int32_t _width{};
+        int32_t _height{};
+        // Sum of everything above and to the left of each cell, with an extra row and column of
+        // zeroes in front so no query needs special casing at the edges
+        std::vector<T> _sums;
+
+        T at(int32_t x, int32_t y) const
+        {
+            return _sums[y * (_width + 1) + x];
+        }
+
+    public:
+        SummedAreaTable() = default;
+
+        // getValue(x, y) is called once for every cell of the grid
+        template<typename TGetValue>
+        SummedAreaTable(int32_t width, int32_t height, TGetValue&& getValue)
+            : _width(width)
+            , _height(height)
+            , _sums((width + 1) * (height + 1))
+        {
+            for (int32_t y = 0; y < height; y++)
+            {
+                T rowSum{};
+                for (int32_t x = 0; x < width; x++)
+                {
+                    rowSum += getValue(x, y);
+                    _sums[(y + 1) * (width + 1) + x + 1] = at(x + 1, y) + rowSum;
+                }
+            }
+        }
+
+        int32_t width() const { return _width; }
+        int32_t height() const { return _height; }
+
+        // Bounds are inclusive, anything outside the grid is left out
+        T sum(int32_t left, int32_t top, int32_t right, int32_t bottom) const
+        {
+            left = std::max(left, 0);
+            top = std::max(top, 0);
+            right = std::min(right, _width - 1);
+            bottom = std::min(bottom, _height - 1);
+            if (left > right || top > bottom)
+            {
+                return T{};
+            }
+            return at(right + 1, bottom + 1) - at(left, bottom + 1) - at(right + 1, top) + at(left, top);
+        }
+    };
+}
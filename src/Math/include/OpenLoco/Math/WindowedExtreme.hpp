@@ -0,0 +1,83 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace OpenLoco::Math
+{
+    // The smallest (or with std::greater, the largest) value in the square window around each cell
+    // of a grid, for one fixed radius. Windows are cut off at the edges of the grid. Like a
+    // SummedAreaTable it does not follow changes to the grid.
+    template<typename T, typename TCompare = std::less<T>>
+    class WindowedExtreme
+    {
+    private:
+        int32_t _width{};
+        int32_t _height{};
+        std::vector<T> _extremes;
+
+        static T pick(T a, T b)
+        {
+            return TCompare{}(b, a) ? b : a;
+        }
+
+    public:
+        WindowedExtreme() = default;
+
+        // getValue(x, y) is called once for every cell of the grid
+        template<typename TGetValue>
+        WindowedExtreme(int32_t width, int32_t height, int32_t radius, TGetValue&& getValue)
+            : _width(width)
+            , _height(height)
+            , _extremes(width * height)
+        {
+            std::vector<T> values(width * height);
+            for (int32_t y = 0; y < height; y++)
+            {
+                for (int32_t x = 0; x < width; x++)
+                {
+                    values[y * width + x] = getValue(x, y);
+                }
+            }
+
+            // Rows first, then columns of the row results
+            std::vector<T> rows(width * height);
+            for (int32_t y = 0; y < height; y++)
+            {
+                for (int32_t x = 0; x < width; x++)
+                {
+                    const auto last = std::min(x + radius, width - 1);
+                    auto extreme = values[y * width + std::max(x - radius, 0)];
+                    for (int32_t i = std::max(x - radius, 0) + 1; i <= last; i++)
+                    {
+                        extreme = pick(extreme, values[y * width + i]);
+                    }
+                    rows[y * width + x] = extreme;
+                }
+            }
+            for (int32_t y = 0; y < height; y++)
+            {
+                const auto last = std::min(y + radius, height - 1);
+                for (int32_t x = 0; x < width; x++)
+                {
+                    auto extreme = rows[std::max(y - radius, 0) * width + x];
+                    for (int32_t i = std::max(y - radius, 0) + 1; i <= last; i++)
+                    {
+                        extreme = pick(extreme, rows[i * width + x]);
+                    }
+                    _extremes[y * width + x] = extreme;
+                }
+            }
+        }
+
+        int32_t width() const { return _width; }
+        int32_t height() const { return _height; }
+
+        T get(int32_t x, int32_t y) const
+        {
+            return _extremes[y * _width + x];
+        }
+    };
+}
@@ -0,0 +1,74 @@
+#include <OpenLoco/Math/SummedAreaTable.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco::Math;
+
+static int32_t bruteForceSum(const std::vector<int32_t>& grid, int32_t width, int32_t height, int32_t left, int32_t top, int32_t right, int32_t bottom)
+{
+    int32_t sum = 0;
+    for (int32_t y = std::max(top, 0); y <= std::min(bottom, height - 1); y++)
+    {
+        for (int32_t x = std::max(left, 0); x <= std::min(right, width - 1); x++)
+        {
+            sum += grid[y * width + x];
+        }
+    }
+    return sum;
+}
+
+TEST(SummedAreaTableTest, singleCell)
+{
+    SummedAreaTable<int32_t> table(1, 1, [](int32_t, int32_t) { return 7; });
+    ASSERT_EQ(table.sum(0, 0, 0, 0), 7);
+    ASSERT_EQ(table.sum(-5, -5, 5, 5), 7);
+    ASSERT_EQ(table.sum(1, 0, 1, 0), 0);
+}
+
+TEST(SummedAreaTableTest, emptyRectangle)
+{
+    SummedAreaTable<int32_t> table(4, 4, [](int32_t, int32_t) { return 1; });
+    ASSERT_EQ(table.sum(3, 0, 2, 3), 0);
+    ASSERT_EQ(table.sum(0, 3, 3, 2), 0);
+    ASSERT_EQ(table.sum(-3, -3, -1, -1), 0);
+    ASSERT_EQ(table.sum(4, 4, 8, 8), 0);
+}
+
+TEST(SummedAreaTableTest, matchesBruteForceAfterEdits)
+{
+    std::mt19937 rng(1234);
+    constexpr int32_t kWidth = 37;
+    constexpr int32_t kHeight = 23;
+    std::vector<int32_t> grid(kWidth * kHeight);
+    for (auto& value : grid)
+    {
+        value = rng() % 4;
+    }
+
+    for (int32_t round = 0; round < 5; round++)
+    {
+        SummedAreaTable<int32_t> table(kWidth, kHeight, [&grid](int32_t x, int32_t y) { return grid[y * kWidth + x]; });
+        for (int32_t y = 0; y < kHeight; y++)
+        {
+            for (int32_t x = 0; x < kWidth; x++)
+            {
+                // The 11x11 neighbourhood used by the game, running off the edges
+                ASSERT_EQ(table.sum(x - 5, y - 5, x + 5, y + 5), bruteForceSum(grid, kWidth, kHeight, x - 5, y - 5, x + 5, y + 5));
+            }
+        }
+        for (int32_t i = 0; i < 1000; i++)
+        {
+            const int32_t left = static_cast<int32_t>(rng() % (kWidth + 10)) - 5;
+            const int32_t top = static_cast<int32_t>(rng() % (kHeight + 10)) - 5;
+            const int32_t right = left + static_cast<int32_t>(rng() % 20);
+            const int32_t bottom = top + static_cast<int32_t>(rng() % 20);
+            ASSERT_EQ(table.sum(left, top, right, bottom), bruteForceSum(grid, kWidth, kHeight, left, top, right, bottom));
+        }
+
+        for (int32_t i = 0; i < 50; i++)
+        {
+            grid[rng() % grid.size()] = rng() % 4;
+        }
+    }
+}
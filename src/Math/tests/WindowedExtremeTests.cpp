@@ -0,0 +1,65 @@
+#include <OpenLoco/Math/WindowedExtreme.hpp>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace OpenLoco::Math;
+
+template<typename TCompare>
+static int32_t bruteForceExtreme(const std::vector<int32_t>& grid, int32_t width, int32_t height, int32_t radius, int32_t x, int32_t y)
+{
+    int32_t extreme = grid[std::max(y - radius, 0) * width + std::max(x - radius, 0)];
+    for (int32_t i = std::max(y - radius, 0); i <= std::min(y + radius, height - 1); i++)
+    {
+        for (int32_t j = std::max(x - radius, 0); j <= std::min(x + radius, width - 1); j++)
+        {
+            if (TCompare{}(grid[i * width + j], extreme))
+            {
+                extreme = grid[i * width + j];
+            }
+        }
+    }
+    return extreme;
+}
+
+TEST(WindowedExtremeTest, radiusZero)
+{
+    WindowedExtreme<int32_t> minimum(3, 2, 0, [](int32_t x, int32_t y) { return x * 10 + y; });
+    ASSERT_EQ(minimum.get(0, 0), 0);
+    ASSERT_EQ(minimum.get(2, 1), 21);
+}
+
+TEST(WindowedExtremeTest, matchesBruteForceAfterEdits)
+{
+    std::mt19937 rng(4321);
+    constexpr int32_t kWidth = 31;
+    constexpr int32_t kHeight = 19;
+    std::vector<int32_t> grid(kWidth * kHeight);
+    for (auto& value : grid)
+    {
+        value = static_cast<int32_t>(rng() % 512) - 256;
+    }
+
+    for (int32_t round = 0; round < 5; round++)
+    {
+        const auto getValue = [&grid](int32_t x, int32_t y) { return grid[y * kWidth + x]; };
+        for (const int32_t radius : { 1, 5, 40 })
+        {
+            WindowedExtreme<int32_t> minimum(kWidth, kHeight, radius, getValue);
+            WindowedExtreme<int32_t, std::greater<int32_t>> maximum(kWidth, kHeight, radius, getValue);
+            for (int32_t y = 0; y < kHeight; y++)
+            {
+                for (int32_t x = 0; x < kWidth; x++)
+                {
+                    ASSERT_EQ(minimum.get(x, y), bruteForceExtreme<std::less<int32_t>>(grid, kWidth, kHeight, radius, x, y));
+                    ASSERT_EQ(maximum.get(x, y), bruteForceExtreme<std::greater<int32_t>>(grid, kWidth, kHeight, radius, x, y));
+                }
+            }
+        }
+
+        for (int32_t i = 0; i < 50; i++)
+        {
+            grid[rng() % grid.size()] = static_cast<int32_t>(rng() % 512) - 256;
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include "Map/TileLoop.hpp"
 #include "Map/TileManager.h"
 #include "Map/TreeElement.h"
+#include "MusicChannel.h"
 #include "Objects/ObjectManager.h"
 #include "Objects/SoundObject.h"
 #include "Objects/TreeObject.h"
@@ -20,9 +21,9 @@
 #include "VehicleChannel.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
-#include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/FileStream.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <unordered_map>
@@ -65,10 +66,11 @@ namespace OpenLoco::Audio
     static std::vector<Channel> _channels;
     static std::vector<VehicleChannel> _vehicleChannels;
     static std::vector<Channel> _soundFX;
+    static std::optional<MusicChannel> _musicChannel;
+    static std::optional<MusicChannel> _ambientChannel;
 
     static std::vector<uint32_t> _samples;
     static std::unordered_map<uint16_t, uint32_t> _objectSamples;
-    static std::unordered_map<PathId, uint32_t> _musicSamples;
 
     static OpenAL::Device _device;
     static OpenAL::SourceManager _sourceManager;
@@ -126,6 +128,19 @@ namespace OpenLoco::Audio
         return id;
     }
 
+    static MusicChannel* getMusicChannel(ChannelId id)
+    {
+        switch (id)
+        {
+            case ChannelId::music:
+                return _musicChannel.has_value() ? &*_musicChannel : nullptr;
+            case ChannelId::ambient:
+                return _ambientChannel.has_value() ? &*_ambientChannel : nullptr;
+            default:
+                return nullptr;
+        }
+    }
+
     static std::vector<uint32_t> loadSoundsFromCSS(const fs::path& path)
     {
         Logging::verbose("loadSoundsFromCSS({})", path.string());
@@ -169,11 +184,12 @@ namespace OpenLoco::Audio
     {
         _samples.clear();
         _objectSamples.clear();
-        _musicSamples.clear();
     }
 
     static void disposeChannels()
     {
+        _musicChannel.reset();
+        _ambientChannel.reset();
         _channels.clear();
         _vehicleChannels.clear();
         _soundFX.clear();
@@ -230,6 +246,8 @@ namespace OpenLoco::Audio
             const auto sourceId = _sourceManager.allocate();
             _channels.push_back(Channel(sourceId));
         }
+        _musicChannel.emplace(_channels[static_cast<size_t>(ChannelId::music)], _bufferManager);
+        _ambientChannel.emplace(_channels[static_cast<size_t>(ChannelId::ambient)], _bufferManager);
         _vehicleChannels.clear();
         for (auto i = 0; i < 10; ++i)
         {
@@ -610,6 +628,14 @@ namespace OpenLoco::Audio
     // 0x0048A18C
     void updateSounds()
     {
+        for (auto* channel : { getMusicChannel(ChannelId::music), getMusicChannel(ChannelId::ambient) })
+        {
+            if (channel != nullptr)
+            {
+                channel->update();
+            }
+        }
+
         if (_soundFX.empty())
         {
             return;
@@ -623,74 +649,17 @@ namespace OpenLoco::Audio
         }
     }
 
-    static std::optional<uint32_t> loadMusicSample(PathId asset)
-    {
-        auto res = _musicSamples.find(asset);
-        if (res != std::end(_musicSamples))
-        {
-            return res->second;
-        }
-
-        const auto path = Environment::getPath(asset);
-        try
-        {
-            FileStream fs(path, StreamMode::read);
-
-            const auto sig = fs.readValue<uint32_t>();
-            if (sig != 0x46464952) // RIFF
-                throw Exception::RuntimeError("Invalid signature.");
-
-            fs.readValue<uint32_t>(); // size
-
-            const auto riffType = fs.readValue<uint32_t>();
-            if (riffType != 0x45564157) // WAVE
-                throw Exception::RuntimeError("Invalid format.");
-
-            const auto fmtMarker = fs.readValue<uint32_t>();
-            // This can be 'fmt\0' or 'fmt '
-            if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
-                throw Exception::RuntimeError("Invalid format marker.");
-
-            fs.readValue<uint32_t>(); // headersize
-
-            const auto typeFormat = fs.readValue<uint16_t>();
-            if (typeFormat != 1)
-                throw Exception::RuntimeError("Invalid format type, expected PCM.");
-
-            const auto channels = fs.readValue<uint16_t>();
-            const auto sampleRate = fs.readValue<uint32_t>();
-
-            fs.readValue<uint32_t>();
-            fs.readValue<uint16_t>();
-
-            const auto bits = fs.readValue<uint16_t>();
-
-            const auto dataMarker = fs.readValue<uint32_t>();
-            if (dataMarker != 0x61746164) // data
-                throw Exception::RuntimeError("Invalid data marker.");
-
-            const auto pcmLen = fs.readValue<uint32_t>();
-
-            std::vector<std::uint8_t> pcm(pcmLen);
-            fs.read(pcm.data(), pcmLen);
-
-            const auto id = _bufferManager.allocate(std::span<const uint8_t>(pcm.data(), pcmLen), sampleRate, channels == 2, bits);
-            _musicSamples[asset] = id;
-
-            return id;
-        }
-        catch (const std::exception& ex)
-        {
-            Logging::error("Unable to load music sample '{}': {}", path, ex.what());
-            return std::nullopt;
-        }
-    }
-
     // 0x00401A05
     static void stopChannel(ChannelId id)
     {
         Logging::verbose("stopChannel({})", static_cast<int>(id));
 
+        if (auto* musicChannel = getMusicChannel(id); musicChannel != nullptr)
+        {
+            musicChannel->stop();
+            return;
+        }
+
         auto channel = getChannel(id);
         if (channel != nullptr)
         {
@@ -767,45 +736,215 @@ namespace OpenLoco::Audio
         }
     }
 
-    static void off_4FEB58(Vehicles::Vehicle2or6* v, int32_t x)
+    // Vehicle sounds are only started for vehicles shown in a viewport, so rather than visiting
+    // every vehicle the candidates are gathered from the entity spatial index around each viewport.
+
+    // Highest a vehicle is expected to be drawn (aircraft cruise above the highest stations)
+    static constexpr int32_t kMaxVehicleSoundZ = 2048;
+    // Visiting a tile of the spatial index is much cheaper than walking a car of a train
+    static constexpr size_t kVehicleSoundTilesPerVehicle = 4;
+
+    // Vehicles left with SoundFlags::flag0 by the last update, these need clearing next update
+    static std::vector<EntityId> _flaggedVehicleSounds;
+    // False when the flags of vehicles not in _flaggedVehicleSounds may also be set (e.g. after a load)
+    static bool _flaggedVehicleSoundsValid = false;
+
+    struct VehicleSoundTileRow
     {
-        switch (x)
+        int32_t column;
+        int32_t firstRow;
+        int32_t lastRow;
+    };
+
+    // Adds the rows of tiles that could contain a vehicle whose sprite (left, top) lies within
+    // the inclusive view rect. Returns the number of tiles added.
+    static size_t getVehicleSoundTileRows(int32_t rotation, int32_t left, int32_t top, int32_t right, int32_t bottom, std::vector<VehicleSoundTileRow>& rows)
+    {
+        // Sprite left/top are up to 255 before the projected position (see EntityBase::moveTo)
+        right += 255;
+        bottom += 255;
+
+        // Projection in rotated map space q: x = q.y - q.x, y = ((q.x + q.y) >> 1) - z
+        const auto minDiff = left - 2;
+        const auto maxDiff = right + 2;
+        const auto minSum = top * 2 - 2;
+        const auto maxSum = (bottom + kMaxVehicleSoundZ) * 2 + 2;
+
+        // The map in rotated space, tiles become cells of the same size
+        const auto mapA = Math::Vector::rotate(World::Pos2(0, 0), rotation);
+        const auto mapB = Math::Vector::rotate(World::Pos2(World::kMapWidth - 1, World::kMapHeight - 1), rotation);
+        const auto minCellX = std::min(mapA.x, mapB.x) >> 5;
+        const auto maxCellX = std::max(mapA.x, mapB.x) >> 5;
+        const auto minCellY = std::min(mapA.y, mapB.y) >> 5;
+        const auto maxCellY = std::max(mapA.y, mapB.y) >> 5;
+
+        const auto firstCellX = std::max<int32_t>(minCellX, ((minSum - maxDiff) >> 1) >> 5);
+        const auto lastCellX = std::min<int32_t>(maxCellX, ((maxSum - minDiff) >> 1) >> 5);
+
+        size_t numTiles = 0;
+        for (auto cellX = firstCellX; cellX <= lastCellX; ++cellX)
+        {
+            const auto qx0 = cellX * World::kTileSize;
+            const auto qx1 = qx0 + World::kTileSize - 1;
+            const auto minY = std::max(minDiff + qx0, minSum - qx1);
+            const auto maxY = std::min(maxDiff + qx1, maxSum - qx0);
+            const auto firstCellY = std::max<int32_t>(minCellY, minY >> 5);
+            const auto lastCellY = std::min<int32_t>(maxCellY, maxY >> 5);
+            if (firstCellY > lastCellY)
+            {
+                continue;
+            }
+            rows.push_back(VehicleSoundTileRow{ cellX, firstCellY, lastCellY });
+            numTiles += lastCellY - firstCellY + 1;
+        }
+        return numTiles;
+    }
+
+    // Mirrors the viewports tested by sub_48A274. Sprite bounds are always in the current
+    // rotation (see EntityBase::moveTo) so that is used rather than each viewport's.
+    static size_t getVehicleSoundTileRows(std::vector<VehicleSoundTileRow>& rows, int32_t rotation)
+    {
+        size_t numTiles = 0;
+        auto main = WindowManager::getMainWindow();
+        if (main != nullptr && main->viewports[0] != nullptr)
         {
-            case 0:
-                v->soundFlags &= ~Vehicles::SoundFlags::flag0;
-                break;
-            case 1:
-                if ((v->soundFlags & Vehicles::SoundFlags::flag1) == Vehicles::SoundFlags::none)
+            const auto* viewport = main->viewports[0];
+            const auto quarterWidth = viewport->viewWidth / 4;
+            const auto quarterHeight = viewport->viewHeight / 4;
+            numTiles += getVehicleSoundTileRows(
+                rotation,
+                viewport->viewX - quarterWidth,
+                viewport->viewY - quarterHeight,
+                viewport->viewX + viewport->viewWidth + quarterWidth,
+                viewport->viewY + viewport->viewHeight + quarterHeight,
+                rows);
+        }
+
+        for (auto i = 0U; i < WindowManager::count(); i++)
+        {
+            auto w = WindowManager::get(i);
+            if (w->type == WindowType::main || w->type == WindowType::news)
+                continue;
+
+            const auto* viewport = w->viewports[0];
+            if (viewport == nullptr)
+                continue;
+
+            numTiles += getVehicleSoundTileRows(
+                rotation,
+                viewport->viewX,
+                viewport->viewY,
+                viewport->viewX + viewport->viewWidth - 1,
+                viewport->viewY + viewport->viewHeight - 1,
+                rows);
+        }
+        return numTiles;
+    }
+
+    // Returns the veh2 and tail of trains that may be audible, ordered as they appear in the
+    // vehicle list (veh2 before tail) as that decides which get a sound when over the limit.
+    static std::vector<Vehicles::Vehicle2or6*> getVehicleSoundCandidates()
+    {
+        std::vector<Vehicles::Vehicle2or6*> candidates;
+
+        std::vector<VehicleSoundTileRow> rows;
+        const auto rotation = WindowManager::getCurrentRotation();
+        const auto numTiles = getVehicleSoundTileRows(rows, rotation);
+        if (numTiles == 0)
+        {
+            return candidates;
+        }
+
+        // Zoomed out far enough that a scan of every train is cheaper
+        const auto numVehicleEntities = EntityManager::getListCount(EntityManager::EntityListType::vehicle);
+        if (numTiles > numVehicleEntities * kVehicleSoundTilesPerVehicle)
+        {
+            for (auto* v : VehicleManager::VehicleList())
+            {
+                Vehicles::Vehicle train(*v);
+                candidates.push_back(reinterpret_cast<Vehicles::Vehicle2or6*>(train.veh2));
+                candidates.push_back(reinterpret_cast<Vehicles::Vehicle2or6*>(train.tail));
+            }
+            return candidates;
+        }
+
+        const auto inverseRotation = (4 - rotation) & 3;
+        for (const auto& row : rows)
+        {
+            for (auto cellY = row.firstRow; cellY <= row.lastRow; ++cellY)
+            {
+                const auto cellCentre = World::Pos2(row.column * World::kTileSize + 16, cellY * World::kTileSize + 16);
+                const auto loc = Math::Vector::rotate(cellCentre, inverseRotation);
+                if (!World::validCoords(loc))
                 {
-                    sub_48A274(v);
+                    continue;
                 }
-                break;
-            case 2:
-                if ((v->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none)
+                for (auto* entity : EntityManager::EntityTileList(loc))
                 {
-                    sub_48A274(v);
+                    auto* vehicle = entity->asBase<Vehicles::VehicleBase>();
+                    if (vehicle == nullptr || !vehicle->isVehicle2Or6())
+                    {
+                        continue;
+                    }
+                    candidates.push_back(vehicle->asVehicle2Or6());
                 }
-                break;
-            case 3:
-                playSound(v);
-                break;
+            }
+        }
+
+        // Viewports can overlap
+        std::sort(candidates.begin(), candidates.end());
+        candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+        std::unordered_map<EntityId, uint32_t> trainOrder;
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            trainOrder.emplace(head->id, static_cast<uint32_t>(trainOrder.size()));
         }
+
+        std::vector<std::pair<uint32_t, Vehicles::Vehicle2or6*>> ordered;
+        for (auto* v : candidates)
+        {
+            auto it = trainOrder.find(v->getHead());
+            if (it == trainOrder.end())
+            {
+                continue;
+            }
+            ordered.emplace_back(it->second * 2 + (v->isVehicleTail() ? 1 : 0), v);
+        }
+        std::sort(ordered.begin(), ordered.end(), [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+        candidates.clear();
+        for (auto& [order, v] : ordered)
+        {
+            candidates.push_back(v);
+        }
+        return candidates;
     }
 
-    // 0x0048A1FA
-    static void sub_48A1FA(int32_t x)
+    static void clearVehicleSoundFlags()
     {
-        if (x == 0)
+        if (!_flaggedVehicleSoundsValid)
         {
-            _numActiveVehicleSounds = 0;
+            for (auto* v : VehicleManager::VehicleList())
+            {
+                Vehicles::Vehicle train(*v);
+                train.veh2->soundFlags &= ~Vehicles::SoundFlags::flag0;
+                train.tail->soundFlags &= ~Vehicles::SoundFlags::flag0;
+            }
+            _flaggedVehicleSoundsValid = true;
         }
-
-        for (auto* v : VehicleManager::VehicleList())
+        else
         {
-            Vehicles::Vehicle train(*v);
-            off_4FEB58(reinterpret_cast<Vehicles::Vehicle2or6*>(train.veh2), x);
-            off_4FEB58(reinterpret_cast<Vehicles::Vehicle2or6*>(train.tail), x);
+            for (const auto id : _flaggedVehicleSounds)
+            {
+                auto* vehicle = EntityManager::get<Vehicles::VehicleBase>(id);
+                if (vehicle != nullptr && vehicle->isVehicle2Or6())
+                {
+                    vehicle->asVehicle2Or6()->soundFlags &= ~Vehicles::SoundFlags::flag0;
+                }
+            }
         }
+        _flaggedVehicleSounds.clear();
     }
 
     // 0x48A73B
@@ -815,14 +954,37 @@ namespace OpenLoco::Audio
         {
             if (!_audioIsPaused && _audioIsEnabled)
             {
-                sub_48A1FA(0);
-                sub_48A1FA(1);
-                sub_48A1FA(2);
+                // 0x0048A1FA is called 4 times here by the original, each a pass over every train
+                clearVehicleSoundFlags();
+                _numActiveVehicleSounds = 0;
+
+                const auto candidates = getVehicleSoundCandidates();
+                for (auto* v : candidates)
+                {
+                    if ((v->soundFlags & Vehicles::SoundFlags::flag1) == Vehicles::SoundFlags::none)
+                    {
+                        sub_48A274(v);
+                    }
+                }
+                for (auto* v : candidates)
+                {
+                    if ((v->soundFlags & Vehicles::SoundFlags::flag1) != Vehicles::SoundFlags::none)
+                    {
+                        sub_48A274(v);
+                    }
+                }
                 for (auto& vc : _vehicleChannels)
                 {
                     vc.update();
                 }
-                sub_48A1FA(3);
+                for (auto* v : candidates)
+                {
+                    playSound(v);
+                    if ((v->soundFlags & Vehicles::SoundFlags::flag0) != Vehicles::SoundFlags::none)
+                    {
+                        _flaggedVehicleSounds.push_back(v->id);
+                    }
+                }
             }
         }
     }
@@ -830,6 +992,7 @@ namespace OpenLoco::Audio
     // 0x00489C6A
     void stopVehicleNoise()
     {
+        _flaggedVehicleSoundsValid = false;
         for (auto& vc : _vehicleChannels)
         {
             vc.stop();
@@ -934,7 +1097,7 @@ namespace OpenLoco::Audio
                 newAmbientSound = PathId::css4;
             }
         }
-        auto* channel = getChannel(ChannelId::ambient);
+        auto* channel = getMusicChannel(ChannelId::ambient);
         if (channel == nullptr)
         {
             return;
@@ -962,12 +1125,9 @@ namespace OpenLoco::Audio
 
         if (_chosenAmbientNoisePathId != *newAmbientSound)
         {
-            auto musicBuffer = loadMusicSample(*newAmbientSound);
-            if (musicBuffer.has_value())
+            channel->setVolume(kAmbientMinVolume);
+            if (channel->play(Environment::getPath(*newAmbientSound), true))
             {
-                channel->load(*musicBuffer);
-                channel->setVolume(kAmbientMinVolume);
-                channel->play(true);
                 _chosenAmbientNoisePathId = *newAmbientSound;
             }
         }
@@ -1105,7 +1265,7 @@ namespace OpenLoco::Audio
             return;
         }
 
-        auto* channel = getChannel(ChannelId::music);
+        auto* channel = getMusicChannel(ChannelId::music);
         if (channel == nullptr)
         {
             return;
@@ -1143,7 +1303,7 @@ namespace OpenLoco::Audio
     // previously called void playTitleScreenMusic()
     bool playMusic(PathId sample, int32_t volume, bool loop)
     {
-        auto* channel = getChannel(ChannelId::music);
+        auto* channel = getMusicChannel(ChannelId::music);
         if (!_audioInitialised || _audioIsPaused || !_audioIsEnabled || channel == nullptr)
         {
             return false;
@@ -1157,14 +1317,8 @@ namespace OpenLoco::Audio
         currentTrackPathId = sample;
         channel->stop();
 
-        auto musicSample = loadMusicSample(sample);
-        if (channel->load(*musicSample))
-        {
-            channel->setVolume(volume);
-            return channel->play(loop);
-        }
-
-        return false;
+        channel->setVolume(volume);
+        return channel->play(Environment::getPath(sample), loop);
     }
 
     // 0x0048AAD2
@@ -1183,7 +1337,7 @@ namespace OpenLoco::Audio
     // previously called void stopTitleMusic()
     void stopMusic()
     {
-        auto* channel = getChannel(ChannelId::music);
+        auto* channel = getMusicChannel(ChannelId::music);
         if (_audioInitialised && channel != nullptr && channel->isPlaying())
         {
             channel->stop();
@@ -1193,6 +1347,7 @@ namespace OpenLoco::Audio
 
     void resetSoundObjects()
     {
+        _flaggedVehicleSoundsValid = false;
         for (auto& sample : _objectSamples)
         {
             _bufferManager.deAllocate(sample.second);
@@ -1222,7 +1377,7 @@ namespace OpenLoco::Audio
         cfg.volume = volume;
         Config::write();
 
-        auto* channel = getChannel(ChannelId::music);
+        auto* channel = getMusicChannel(ChannelId::music);
         if (channel == nullptr)
         {
             return;
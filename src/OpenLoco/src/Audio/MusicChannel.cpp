@@ -0,0 +1,346 @@
+#include "MusicChannel.h"
+#include "Logging.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Audio
+{
+    // ~0.75 seconds of 22kHz 16 bit stereo per buffer
+    static constexpr size_t kChunkSize = 64 * 1024;
+    // Chunks read ahead of what has been queued
+    static constexpr size_t kMaxReadyChunks = 4;
+
+    struct WaveFormat
+    {
+        uint32_t sampleRate{};
+        uint16_t channels{};
+        uint16_t bits{};
+    };
+
+    struct MusicChunk
+    {
+        std::vector<uint8_t> pcm;
+        WaveFormat format;
+    };
+
+    struct WaveFile
+    {
+        FileStream stream;
+        WaveFormat format;
+        size_t dataBegin{};
+        size_t dataEnd{};
+    };
+
+    static void openWaveFile(WaveFile& file, const fs::path& path)
+    {
+        auto& fs = file.stream;
+        fs.close();
+        if (!fs.open(path, StreamMode::read))
+            throw Exception::RuntimeError("Unable to open file.");
+
+        const auto sig = fs.readValue<uint32_t>();
+        if (sig != 0x46464952) // RIFF
+            throw Exception::RuntimeError("Invalid signature.");
+
+        fs.readValue<uint32_t>(); // size
+
+        const auto riffType = fs.readValue<uint32_t>();
+        if (riffType != 0x45564157) // WAVE
+            throw Exception::RuntimeError("Invalid format.");
+
+        const auto fmtMarker = fs.readValue<uint32_t>();
+        // This can be 'fmt\0' or 'fmt '
+        if (fmtMarker != 0x20746d66 && fmtMarker != 0x00746d66)
+            throw Exception::RuntimeError("Invalid format marker.");
+
+        fs.readValue<uint32_t>(); // headersize
+
+        const auto typeFormat = fs.readValue<uint16_t>();
+        if (typeFormat != 1)
+            throw Exception::RuntimeError("Invalid format type, expected PCM.");
+
+        file.format.channels = fs.readValue<uint16_t>();
+        file.format.sampleRate = fs.readValue<uint32_t>();
+
+        fs.readValue<uint32_t>();
+        fs.readValue<uint16_t>();
+
+        file.format.bits = fs.readValue<uint16_t>();
+
+        const auto dataMarker = fs.readValue<uint32_t>();
+        if (dataMarker != 0x61746164) // data
+            throw Exception::RuntimeError("Invalid data marker.");
+
+        const auto pcmLen = fs.readValue<uint32_t>();
+
+        // Only whole sample frames can be handed to OpenAL
+        const size_t frameSize = std::max(file.format.channels * file.format.bits / 8, 1);
+        const auto available = std::min<size_t>(pcmLen, fs.getLength() - fs.getPosition());
+        file.dataBegin = fs.getPosition();
+        file.dataEnd = file.dataBegin + available - available % frameSize;
+        if (file.dataEnd == file.dataBegin)
+            throw Exception::RuntimeError("No sample data.");
+    }
+
+    // Reads the next chunk, wrapping back to the start of the data when looping. Returns true
+    // once the end of the data has been reached without looping.
+    static bool readWaveChunk(WaveFile& file, bool loop, std::vector<uint8_t>& pcm)
+    {
+        auto& fs = file.stream;
+        pcm.resize(kChunkSize);
+        size_t filled = 0;
+        while (filled < pcm.size())
+        {
+            const auto remaining = file.dataEnd - fs.getPosition();
+            if (remaining == 0)
+            {
+                if (!loop)
+                {
+                    pcm.resize(filled);
+                    return true;
+                }
+                fs.setPosition(file.dataBegin);
+                continue;
+            }
+            const auto len = std::min(pcm.size() - filled, remaining);
+            fs.read(pcm.data() + filled, len);
+            filled += len;
+        }
+        return !loop && fs.getPosition() == file.dataEnd;
+    }
+
+    // Background reader for a MusicChannel. Every open or close starts a new generation so
+    // chunks of a track that is no longer wanted are discarded instead of waited on. Files are
+    // opened by the caller so a missing or broken file is reported by play.
+    class MusicStream
+    {
+    private:
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::deque<MusicChunk> _ready;
+        std::unique_ptr<WaveFile> _nextFile;
+        uint32_t _generation = 0;
+        bool _loop = false;
+        bool _finished = true;
+        bool _quit = false;
+        std::thread _thread;
+
+        void run()
+        {
+            std::unique_ptr<WaveFile> file;
+            uint32_t generation = 0;
+
+            std::unique_lock lock(_mutex);
+            while (true)
+            {
+                _wake.wait(lock, [&] {
+                    return _quit || (!_finished && (generation != _generation || _ready.size() < kMaxReadyChunks));
+                });
+                if (_quit)
+                {
+                    return;
+                }
+
+                if (generation != _generation)
+                {
+                    generation = _generation;
+                    file = std::move(_nextFile);
+                    continue;
+                }
+
+                const auto loop = _loop;
+                lock.unlock();
+                MusicChunk chunk{ {}, file->format };
+                bool endOfData = true;
+                try
+                {
+                    endOfData = readWaveChunk(*file, loop, chunk.pcm);
+                }
+                catch (const std::exception& ex)
+                {
+                    Logging::error("Unable to read music sample: {}", ex.what());
+                }
+                lock.lock();
+                if (generation != _generation)
+                {
+                    continue;
+                }
+                if (!chunk.pcm.empty())
+                {
+                    _ready.push_back(std::move(chunk));
+                }
+                if (endOfData)
+                {
+                    _finished = true;
+                }
+            }
+        }
+
+    public:
+        MusicStream()
+            : _thread([this] { run(); })
+        {
+        }
+
+        ~MusicStream()
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _quit = true;
+            }
+            _wake.notify_one();
+            _thread.join();
+        }
+
+        void open(std::unique_ptr<WaveFile> file, bool loop)
+        {
+            {
+                std::lock_guard lock(_mutex);
+                _generation++;
+                _nextFile = std::move(file);
+                _loop = loop;
+                _finished = false;
+                _ready.clear();
+            }
+            _wake.notify_one();
+        }
+
+        void close()
+        {
+            std::lock_guard lock(_mutex);
+            _generation++;
+            _nextFile = nullptr;
+            _finished = true;
+            _ready.clear();
+        }
+
+        // Never waits on the reader, it only holds the lock while not touching the file.
+        std::optional<MusicChunk> pop()
+        {
+            std::optional<MusicChunk> chunk;
+            {
+                std::lock_guard lock(_mutex);
+                if (_ready.empty())
+                {
+                    return std::nullopt;
+                }
+                chunk = std::move(_ready.front());
+                _ready.pop_front();
+            }
+            _wake.notify_one();
+            return chunk;
+        }
+
+        // Whole file has been read and every chunk taken
+        bool isDrained()
+        {
+            std::lock_guard lock(_mutex);
+            return _finished && _ready.empty();
+        }
+    };
+
+    MusicChannel::MusicChannel(const Channel& channel, OpenAL::BufferManager& bufferManager)
+        : _channel(channel)
+        , _bufferManager(bufferManager)
+        , _stream(std::make_unique<MusicStream>())
+    {
+        for (auto& buffer : _buffers)
+        {
+            buffer = _bufferManager.allocate();
+        }
+        _freeBuffers.assign(_buffers.begin(), _buffers.end());
+    }
+
+    // Buffers and the source are released along with all the others by disposeDSound
+    MusicChannel::~MusicChannel() = default;
+
+    bool MusicChannel::play(const fs::path& path, bool loop)
+    {
+        stop();
+
+        // Only the header is read here, the sample data is left to the stream
+        auto file = std::make_unique<WaveFile>();
+        try
+        {
+            openWaveFile(*file, path);
+        }
+        catch (const std::exception& ex)
+        {
+            Logging::error("Unable to load music sample '{}': {}", path, ex.what());
+            return false;
+        }
+
+        // The stream does the looping, the source only ever sees the queue
+        auto source = _channel.getSource();
+        source.setLooping(false);
+
+        _stream->open(std::move(file), loop);
+        _isActive = true;
+        return true;
+    }
+
+    void MusicChannel::stop()
+    {
+        _stream->close();
+        // Also unqueues every buffer
+        _channel.stop();
+        _freeBuffers.assign(_buffers.begin(), _buffers.end());
+        _isActive = false;
+    }
+
+    void MusicChannel::update()
+    {
+        if (!_isActive)
+        {
+            return;
+        }
+
+        auto source = _channel.getSource();
+
+        std::array<uint32_t, kNumBuffers> processed{};
+        const auto numProcessed = source.unqueueProcessedBuffers(processed);
+        _freeBuffers.insert(_freeBuffers.end(), processed.begin(), processed.begin() + numProcessed);
+
+        while (!_freeBuffers.empty())
+        {
+            auto chunk = _stream->pop();
+            if (!chunk.has_value())
+            {
+                break;
+            }
+
+            const auto buffer = _freeBuffers.back();
+            _freeBuffers.pop_back();
+            _bufferManager.setData(buffer, chunk->pcm, chunk->format.sampleRate, chunk->format.channels == 2, static_cast<uint8_t>(chunk->format.bits));
+            source.queueBuffers(std::span<const uint32_t>(&buffer, 1));
+        }
+
+        if (source.isPlaying())
+        {
+            return;
+        }
+
+        // Either the first chunks have just arrived or the reader fell behind and the queue ran dry
+        if (source.getQueuedBufferCount() != 0)
+        {
+            source.play();
+        }
+        else if (_stream->isDrained())
+        {
+            _isActive = false;
+        }
+    }
+
+    void MusicChannel::setVolume(int32_t volume)
+    {
+        _channel.setVolume(volume);
+    }
+}
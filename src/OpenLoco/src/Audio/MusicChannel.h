@@ -0,0 +1,44 @@
+#pragma once
+#include "Channel.h"
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace OpenLoco::Audio
+{
+    class MusicStream;
+
+    // Plays a wave file through a small ring of queued buffers. The file is read by a background
+    // thread, update only hands chunks that are already in memory over to OpenAL so starting or
+    // changing a track never waits on the disk and only a few seconds of it are ever resident.
+    class MusicChannel
+    {
+    public:
+        static constexpr size_t kNumBuffers = 4;
+
+    private:
+        Channel _channel;
+        OpenAL::BufferManager& _bufferManager;
+        std::array<uint32_t, kNumBuffers> _buffers{};
+        std::vector<uint32_t> _freeBuffers;
+        std::unique_ptr<MusicStream> _stream;
+        bool _isActive = false;
+
+    public:
+        MusicChannel(const Channel& channel, OpenAL::BufferManager& bufferManager);
+        MusicChannel(const MusicChannel&) = delete;
+        MusicChannel& operator=(const MusicChannel&) = delete;
+        ~MusicChannel();
+
+        // Returns false if the file can not be opened or is not a PCM wave file
+        bool play(const fs::path& path, bool loop);
+        void stop();
+        // Queues any chunks the reader has finished and restarts the source after an underrun
+        void update();
+        void setVolume(int32_t volume);
+        // True from a successful play until the last chunk has been heard (or reading failed)
+        bool isPlaying() const { return _isActive; }
+        const Channel::Attributes& getAttributes() const { return _channel.getAttributes(); }
+    };
+}
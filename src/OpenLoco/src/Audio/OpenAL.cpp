@@ -126,6 +126,30 @@ namespace OpenAL
         alSourcei(_id, AL_LOOPING, value ? AL_TRUE : AL_FALSE);
     }
 
+    void Source::queueBuffers(std::span<const uint32_t> bufferIds)
+    {
+        alSourceQueueBuffers(_id, static_cast<ALsizei>(bufferIds.size()), bufferIds.data());
+    }
+
+    size_t Source::unqueueProcessedBuffers(std::span<uint32_t> bufferIds)
+    {
+        int32_t processed = 0;
+        alGetSourcei(_id, AL_BUFFERS_PROCESSED, &processed);
+        const auto count = std::min(static_cast<size_t>(std::max(processed, 0)), bufferIds.size());
+        if (count != 0)
+        {
+            alSourceUnqueueBuffers(_id, static_cast<ALsizei>(count), bufferIds.data());
+        }
+        return count;
+    }
+
+    size_t Source::getQueuedBufferCount() const
+    {
+        int32_t queued = 0;
+        alGetSourcei(_id, AL_BUFFERS_QUEUED, &queued);
+        return static_cast<size_t>(std::max(queued, 0));
+    }
+
     bool Source::isPlaying() const
     {
         int32_t value = AL_PLAYING;
@@ -158,10 +182,22 @@ namespace OpenAL
     }
 
     uint32_t BufferManager::allocate(std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits)
+    {
+        const auto id = allocate();
+        setData(id, data, sampleRate, stereo, bits);
+        return id;
+    }
+
+    uint32_t BufferManager::allocate()
     {
         uint32_t id = 0;
         alGenBuffers(1, &id);
         _buffers.push_back(id);
+        return id;
+    }
+
+    void BufferManager::setData(uint32_t id, std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits)
+    {
         uint32_t format = 0;
         if (stereo)
         {
@@ -186,7 +222,6 @@ namespace OpenAL
             }
         }
         alBufferData(id, format, data.data(), data.size(), sampleRate);
-        return id;
     }
 
     void BufferManager::deAllocate(uint32_t id)
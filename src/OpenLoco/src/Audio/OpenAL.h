@@ -31,6 +31,11 @@ namespace OpenAL
         // value to be of the range -0.5f -> 0.5f
         void setPan(float value);
         void setLooping(bool value);
+        // Appends buffers to be played after those already queued (do not mix with setBuffer)
+        void queueBuffers(std::span<const uint32_t> bufferIds);
+        // Removes buffers that have finished playing from the queue, returns how many were written to bufferIds
+        size_t unqueueProcessedBuffers(std::span<uint32_t> bufferIds);
+        size_t getQueuedBufferCount() const;
         bool isPlaying() const;
         uint32_t getId() const { return _id; }
     };
@@ -70,6 +75,9 @@ namespace OpenAL
     public:
         ~BufferManager();
         uint32_t allocate(std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits);
+        // Allocates an empty buffer to be filled later with setData
+        uint32_t allocate();
+        void setData(uint32_t id, std::span<const uint8_t> data, uint32_t sampleRate, bool stereo, uint8_t bits);
         void deAllocate(uint32_t id);
         void dispose();
     };
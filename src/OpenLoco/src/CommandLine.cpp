@@ -20,6 +20,10 @@ namespace OpenLoco
 
     static int uncompressFile(const CommandLineOptions& options);
     static int simulate(const CommandLineOptions& options);
+    static int replay(const CommandLineOptions& options);
+    static int screenshot(const CommandLineOptions& options);
+    static int pickCheck(const CommandLineOptions& options);
+    static int treeCheck(const CommandLineOptions& options);
 
     const CommandLineOptions& getCommandLineOptions()
     {
@@ -298,6 +302,8 @@ namespace OpenLoco
                           .registerOption("--help", "-h")
                           .registerOption("--version")
                           .registerOption("--intro")
+                          .registerOption("--record", 1)
+                          .registerOption("--verify")
                           .registerOption("--log_levels", 1);
 
         if (!parser.parse())
@@ -343,6 +349,29 @@ namespace OpenLoco
                 options.path = parser.getArg(1);
                 options.ticks = parser.getArg<int32_t>(2);
             }
+            else if (firstArg == "replay")
+            {
+                options.action = CommandLineAction::replay;
+                options.path = parser.getArg(1);
+            }
+            else if (firstArg == "screenshot")
+            {
+                options.action = CommandLineAction::screenshot;
+                options.path = parser.getArg(1);
+                options.zoom = parser.getArg<int32_t>(2);
+            }
+            else if (firstArg == "pickcheck")
+            {
+                options.action = CommandLineAction::pickcheck;
+                options.path = parser.getArg(1);
+                options.zoom = parser.getArg<int32_t>(2);
+            }
+            else if (firstArg == "treecheck")
+            {
+                options.action = CommandLineAction::treecheck;
+                options.path = parser.getArg(1);
+                options.seed = parser.getArg<int32_t>(2);
+            }
             else
             {
                 options.path = parser.getArg(0);
@@ -354,6 +383,8 @@ namespace OpenLoco
         if (!options.port)
             options.port = parser.getArg<int32_t>("-p");
         options.outputPath = parser.getArg("-o");
+        options.recordPath = parser.getArg("--record");
+        options.verify = parser.hasOption("--verify");
 
         if (parser.hasOption("--log_levels"))
             options.logLevels = parser.getArg("--log_levels");
@@ -376,6 +407,10 @@ namespace OpenLoco
         std::cout << "                join [options] <address>" << std::endl;
         std::cout << "                uncompress [options] <path>" << std::endl;
         std::cout << "                simulate [options] <path> <ticks>" << std::endl;
+        std::cout << "                replay [options] <path>" << std::endl;
+        std::cout << "                screenshot [options] <path> [zoom]" << std::endl;
+        std::cout << "                pickcheck [options] <path> [zoom]" << std::endl;
+        std::cout << "                treecheck [options] <path> [seed]" << std::endl;
         std::cout << std::endl;
         std::cout << "options:" << std::endl;
         std::cout << "--bind            Address to bind to when hosting a server" << std::endl;
@@ -384,6 +419,8 @@ namespace OpenLoco
         std::cout << "--help     -h     Print help" << std::endl;
         std::cout << "--version         Print version" << std::endl;
         std::cout << "--intro           Run the game intro" << std::endl;
+        std::cout << "--record          Record the game commands of the session to the given path for replay" << std::endl;
+        std::cout << "--verify          Check the game's indices after every tick of a replay (slow)" << std::endl;
         std::cout << "--log_levels      Comma separated list of log levels, applying a minus prefix" << std::endl;
         std::cout << "                  removes the level from a group such as 'all', valid levels:" << std::endl;
         std::cout << "                  - info, warning, error, verbose, all" << std::endl;
@@ -405,6 +442,14 @@ namespace OpenLoco
                 return uncompressFile(options);
             case CommandLineAction::simulate:
                 return simulate(options);
+            case CommandLineAction::replay:
+                return replay(options);
+            case CommandLineAction::screenshot:
+                return screenshot(options);
+            case CommandLineAction::pickcheck:
+                return pickCheck(options);
+            case CommandLineAction::treecheck:
+                return treeCheck(options);
             default:
                 return {};
         }
@@ -548,4 +593,181 @@ namespace OpenLoco
 
         return 0;
     }
+
+    static int replay(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No game command log specified.");
+            return 2;
+        }
+
+        auto inPath = fs::u8path(options.path);
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+
+        bool matched = false;
+        try
+        {
+            matched = OpenLoco::replayGame(inPath, options.verify);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to replay {}: {}", inPath.u8string(), e.what());
+            return 2;
+        }
+
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+        auto& gameState = getGameState();
+        Logging::info("--------------------------------");
+        Logging::info("- Replay");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path: {}", inPath.u8string());
+        Logging::info("  verify: {}", options.verify);
+        Logging::info("Output:");
+        Logging::info("  scenario ticks: {}", gameState.scenarioTicks);
+        Logging::info("  rng:            {{ {}, {} }}", gameState.rng.srand_0(), gameState.rng.srand_1());
+        Logging::info("  result:         {}", matched ? "matched recording" : "diverged");
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+
+        return matched ? 0 : 1;
+    }
+
+    static int screenshot(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No game specified.");
+            return 2;
+        }
+
+        const auto zoom = options.zoom.value_or(0);
+        if (zoom < 0 || zoom > 3)
+        {
+            Logging::error("Zoom level must be between 0 and 3.");
+            return 2;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        auto outPath = fs::u8path(options.outputPath);
+        if (outPath.empty())
+        {
+            outPath = inPath;
+            outPath.replace_extension(".png");
+        }
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+
+        try
+        {
+            OpenLoco::screenshotGame(inPath, outPath, static_cast<uint8_t>(zoom));
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to save screenshot of {}: {}", inPath.u8string(), e.what());
+            return 2;
+        }
+
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+        Logging::info("--------------------------------");
+        Logging::info("- Screenshot");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path: {}", inPath.u8string());
+        Logging::info("  zoom: {}", zoom);
+        Logging::info("Output:");
+        Logging::info("  path: {}", outPath.u8string());
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+
+        return 0;
+    }
+
+    // Checks the pick buffer against paint session hit testing as the game has no test target of its own
+    static int pickCheck(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No game specified.");
+            return 2;
+        }
+
+        const auto zoom = options.zoom.value_or(0);
+        if (zoom < 0 || zoom > 3)
+        {
+            Logging::error("Zoom level must be between 0 and 3.");
+            return 2;
+        }
+
+        auto inPath = fs::u8path(options.path);
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+
+        uint32_t numDifferences = 0;
+        try
+        {
+            numDifferences = OpenLoco::pickCheckGame(inPath, static_cast<uint8_t>(zoom));
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to check pick buffer of {}: {}", inPath.u8string(), e.what());
+            return 2;
+        }
+
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+        Logging::info("--------------------------------");
+        Logging::info("- Pick check");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path: {}", inPath.u8string());
+        Logging::info("  zoom: {}", zoom);
+        Logging::info("Output:");
+        Logging::info("  differences: {}", numDifferences);
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+
+        return numDifferences == 0 ? 0 : 1;
+    }
+
+    // Checks tree planting for landscape generation against the game command as the game has no test target of its own
+    static int treeCheck(const CommandLineOptions& options)
+    {
+        if (options.path.empty())
+        {
+            Logging::error("No game specified.");
+            return 2;
+        }
+
+        auto inPath = fs::u8path(options.path);
+        const auto seed = options.seed.has_value() ? std::optional<uint32_t>(static_cast<uint32_t>(*options.seed)) : std::nullopt;
+
+        const auto timeStarted = std::chrono::high_resolution_clock::now();
+
+        bool matched = false;
+        try
+        {
+            matched = OpenLoco::treeCheckGame(inPath, seed);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to check tree planting of {}: {}", inPath.u8string(), e.what());
+            return 2;
+        }
+
+        const auto timeElapsed = std::chrono::high_resolution_clock::now() - timeStarted;
+
+        Logging::info("--------------------------------");
+        Logging::info("- Tree check");
+        Logging::info("--------------------------------");
+        Logging::info("Input:");
+        Logging::info("  path: {}", inPath.u8string());
+        Logging::info("  seed: {}", seed.has_value() ? std::to_string(*seed) : "save");
+        Logging::info("Output:");
+        Logging::info("  result: {}", matched ? "identical" : "diverged");
+        Logging::info("Duration: {:%S} sec", timeElapsed);
+
+        return matched ? 0 : 1;
+    }
 }
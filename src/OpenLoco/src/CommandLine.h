@@ -14,6 +14,10 @@ namespace OpenLoco
         join,
         uncompress,
         simulate,
+        replay,
+        screenshot,
+        pickcheck,
+        treecheck,
         help,
         version,
         intro,
@@ -25,7 +29,11 @@ namespace OpenLoco
         std::string address;
         std::string path;
         std::optional<int32_t> ticks;
+        std::optional<int32_t> zoom;
+        std::optional<int32_t> seed;
         std::string outputPath;
+        std::string recordPath;
+        bool verify = false;
         std::string bind;
         std::optional<uint16_t> port{};
         std::string logLevels;
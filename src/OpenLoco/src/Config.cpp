@@ -250,7 +250,9 @@ namespace OpenLoco::Config
         // Rendering
         _newConfig.scaleFactor = config["scale_factor"].as<float>(1.0f);
         _newConfig.showFPS = config["showFPS"].as<bool>(false);
+        _newConfig.showProfiler = config["showProfiler"].as<bool>(false);
         _newConfig.uncapFPS = config["uncapFPS"].as<bool>(false);
+        _newConfig.pickBuffer = config["pickBuffer"].as<bool>(false);
 
         // General UI
         _newConfig.allowMultipleInstances = config["allow_multiple_instances"].as<bool>(false);
@@ -337,7 +339,9 @@ namespace OpenLoco::Config
         // Rendering
         node["scale_factor"] = _newConfig.scaleFactor;
         node["showFPS"] = _newConfig.showFPS;
+        node["showProfiler"] = _newConfig.showProfiler;
         node["uncapFPS"] = _newConfig.uncapFPS;
+        node["pickBuffer"] = _newConfig.pickBuffer;
 
         // General UI
         node["allow_multiple_instances"] = _newConfig.allowMultipleInstances;
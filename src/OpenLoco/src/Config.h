@@ -172,7 +172,9 @@ namespace OpenLoco::Config
 
         float scaleFactor = 1.0f;
         bool showFPS = false;
+        bool showProfiler = false;
         bool uncapFPS = false;
+        bool pickBuffer = false;
 
         bool allowMultipleInstances = false;
         bool cashPopupRendering = true;
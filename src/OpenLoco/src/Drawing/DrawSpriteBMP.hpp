@@ -2,8 +2,10 @@
 
 #include "DrawSprite.h"
 #include "DrawSpriteHelper.hpp"
+#include "DrawSpriteSIMD.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
+#include <algorithm>
 
 namespace OpenLoco::Drawing
 {
@@ -39,6 +41,31 @@ namespace OpenLoco::Drawing
                 noiseMask = nextNoiseMask;
             }
         }
+        else if constexpr (TZoomLevel == 0 && (TBlendOp == DrawBlendOp::none || TBlendOp == DrawBlendOp::transparent || TBlendOp == (DrawBlendOp::transparent | DrawBlendOp::src)))
+        {
+            // Every source pixel is sampled so whole rows can be handed to the row kernels
+            if (width <= 0)
+            {
+                return;
+            }
+            for (; height > 0; height--)
+            {
+                if constexpr (TBlendOp == DrawBlendOp::none)
+                {
+                    std::copy_n(src, width, dst);
+                }
+                else if constexpr (TBlendOp == DrawBlendOp::transparent)
+                {
+                    blitRowTransparent(src, dst, width);
+                }
+                else
+                {
+                    blitRowPaletteTransparent(src, dst, width, paletteMap);
+                }
+                src += srcLineWidth;
+                dst += dstLineWidth;
+            }
+        }
         else
         {
             for (; height > 0; height -= zoom)
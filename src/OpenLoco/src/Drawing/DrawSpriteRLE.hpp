@@ -2,6 +2,7 @@
 
 #include "DrawSprite.h"
 #include "DrawSpriteHelper.hpp"
+#include "DrawSpriteSIMD.h"
 #include "Graphics/Gfx.h"
 #include "Graphics/RenderTarget.h"
 
@@ -89,6 +90,14 @@ namespace OpenLoco::Drawing
                         std::copy_n(src, numPixels, dst);
                     }
                 }
+                else if constexpr (TBlendOp == (DrawBlendOp::transparent | DrawBlendOp::src) && TZoomLevel == 0)
+                {
+                    // Runs are opaque but the palette map can still produce transparent pixels
+                    if (numPixels > 0)
+                    {
+                        blitRowPaletteTransparent(src, dst, numPixels, args.palMap);
+                    }
+                }
                 else
                 {
                     auto& paletteMap = args.palMap;
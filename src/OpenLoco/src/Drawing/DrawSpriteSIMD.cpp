@@ -0,0 +1,254 @@
+#include "DrawSpriteSIMD.h"
+#include "DrawSprite.h"
+#include "DrawSpriteHelper.hpp"
+
+#if defined(__i386__) || defined(__x86_64__) || defined(_M_IX86) || defined(_M_X64)
+#define OPENLOCO_SIMD_X86
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+#if defined(OPENLOCO_SIMD_X86) && (defined(__GNUC__) || defined(__clang__))
+// 32-bit builds do not enable SSE2/AVX2 globally so the kernels opt in per function
+#define OPENLOCO_TARGET_SSE2 __attribute__((target("sse2")))
+#define OPENLOCO_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define OPENLOCO_TARGET_SSE2
+#define OPENLOCO_TARGET_AVX2
+#endif
+
+namespace OpenLoco::Drawing
+{
+    using BlitRowTransparentFunc = void (*)(const uint8_t*, uint8_t*, size_t);
+    using BlitRowPaletteTransparentFunc = void (*)(const uint8_t*, uint8_t*, size_t, const Gfx::PaletteMap::View);
+
+    static void blitRowTransparentScalar(const uint8_t* src, uint8_t* dst, size_t length)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            blitPixel<DrawBlendOp::transparent>(src[i], dst[i], {}, 0xFF);
+        }
+    }
+
+    static void blitRowPaletteTransparentScalar(const uint8_t* src, uint8_t* dst, size_t length, const Gfx::PaletteMap::View paletteMap)
+    {
+        for (size_t i = 0; i < length; ++i)
+        {
+            blitPixel<DrawBlendOp::transparent | DrawBlendOp::src>(src[i], dst[i], paletteMap, 0xFF);
+        }
+    }
+
+#ifdef OPENLOCO_SIMD_X86
+    OPENLOCO_TARGET_SSE2 static void blitRowTransparentSSE2(const uint8_t* src, uint8_t* dst, size_t length)
+    {
+        const auto zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+        {
+            const auto srcPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            const auto isTransparent = _mm_cmpeq_epi8(srcPixels, zero);
+            const auto transparentMask = _mm_movemask_epi8(isTransparent);
+            if (transparentMask == 0xFFFF)
+            {
+                continue;
+            }
+            auto* dstPixels = reinterpret_cast<__m128i*>(dst + i);
+            if (transparentMask == 0)
+            {
+                _mm_storeu_si128(dstPixels, srcPixels);
+                continue;
+            }
+            const auto oldPixels = _mm_loadu_si128(dstPixels);
+            _mm_storeu_si128(dstPixels, _mm_or_si128(_mm_and_si128(isTransparent, oldPixels), _mm_andnot_si128(isTransparent, srcPixels)));
+        }
+        blitRowTransparentScalar(src + i, dst + i, length - i);
+    }
+
+    OPENLOCO_TARGET_SSE2 static void blitRowPaletteTransparentSSE2(const uint8_t* src, uint8_t* dst, size_t length, const Gfx::PaletteMap::View paletteMap)
+    {
+        const auto zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+        {
+            const auto srcPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi8(srcPixels, zero)) == 0xFFFF)
+            {
+                continue;
+            }
+
+            // There is no byte gather so the lookup itself stays scalar
+            alignas(16) uint8_t remapped[16];
+            for (size_t j = 0; j < 16; ++j)
+            {
+                remapped[j] = paletteMap[src[i + j]];
+            }
+            const auto remappedPixels = _mm_load_si128(reinterpret_cast<const __m128i*>(remapped));
+
+            // Keep the destination where either the source or the remapped pixel is transparent
+            const auto keepDst = _mm_or_si128(_mm_cmpeq_epi8(srcPixels, zero), _mm_cmpeq_epi8(remappedPixels, zero));
+            auto* dstPixels = reinterpret_cast<__m128i*>(dst + i);
+            const auto oldPixels = _mm_loadu_si128(dstPixels);
+            _mm_storeu_si128(dstPixels, _mm_or_si128(_mm_and_si128(keepDst, oldPixels), _mm_andnot_si128(keepDst, remappedPixels)));
+        }
+        blitRowPaletteTransparentScalar(src + i, dst + i, length - i, paletteMap);
+    }
+
+    OPENLOCO_TARGET_AVX2 static void blitRowTransparentAVX2(const uint8_t* src, uint8_t* dst, size_t length)
+    {
+        const auto zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+        {
+            const auto srcPixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const auto isTransparent = _mm256_cmpeq_epi8(srcPixels, zero);
+            const auto transparentMask = static_cast<uint32_t>(_mm256_movemask_epi8(isTransparent));
+            if (transparentMask == 0xFFFFFFFFU)
+            {
+                continue;
+            }
+            auto* dstPixels = reinterpret_cast<__m256i*>(dst + i);
+            if (transparentMask == 0)
+            {
+                _mm256_storeu_si256(dstPixels, srcPixels);
+                continue;
+            }
+            const auto oldPixels = _mm256_loadu_si256(dstPixels);
+            _mm256_storeu_si256(dstPixels, _mm256_blendv_epi8(srcPixels, oldPixels, isTransparent));
+        }
+        blitRowTransparentSSE2(src + i, dst + i, length - i);
+    }
+
+    OPENLOCO_TARGET_AVX2 static void blitRowPaletteTransparentAVX2(const uint8_t* src, uint8_t* dst, size_t length, const Gfx::PaletteMap::View paletteMap)
+    {
+        const auto zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+        {
+            const auto srcPixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+            const auto isTransparent = _mm256_cmpeq_epi8(srcPixels, zero);
+            if (static_cast<uint32_t>(_mm256_movemask_epi8(isTransparent)) == 0xFFFFFFFFU)
+            {
+                continue;
+            }
+
+            alignas(32) uint8_t remapped[32];
+            for (size_t j = 0; j < 32; ++j)
+            {
+                remapped[j] = paletteMap[src[i + j]];
+            }
+            const auto remappedPixels = _mm256_load_si256(reinterpret_cast<const __m256i*>(remapped));
+
+            const auto keepDst = _mm256_or_si256(isTransparent, _mm256_cmpeq_epi8(remappedPixels, zero));
+            auto* dstPixels = reinterpret_cast<__m256i*>(dst + i);
+            const auto oldPixels = _mm256_loadu_si256(dstPixels);
+            _mm256_storeu_si256(dstPixels, _mm256_blendv_epi8(remappedPixels, oldPixels, keepDst));
+        }
+        blitRowPaletteTransparentSSE2(src + i, dst + i, length - i, paletteMap);
+    }
+
+    enum class SimdLevel : uint8_t
+    {
+        none,
+        sse2,
+        avx2,
+    };
+
+    static SimdLevel detectSimdLevel()
+    {
+#if defined(_MSC_VER)
+        int info[4]{};
+        __cpuid(info, 0);
+        const auto maxLeaf = info[0];
+
+        __cpuid(info, 1);
+        const bool hasSSE2 = (info[3] & (1 << 26)) != 0;
+        const bool hasOSXSave = (info[2] & (1 << 27)) != 0;
+        const bool hasAVX = (info[2] & (1 << 28)) != 0;
+        if (!hasSSE2)
+        {
+            return SimdLevel::none;
+        }
+        if (maxLeaf >= 7 && hasOSXSave && hasAVX && (_xgetbv(0) & 0x6) == 0x6)
+        {
+            __cpuidex(info, 7, 0);
+            if ((info[1] & (1 << 5)) != 0)
+            {
+                return SimdLevel::avx2;
+            }
+        }
+        return SimdLevel::sse2;
+#else
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+        {
+            return SimdLevel::avx2;
+        }
+        if (__builtin_cpu_supports("sse2"))
+        {
+            return SimdLevel::sse2;
+        }
+        return SimdLevel::none;
+#endif
+    }
+#else
+    enum class SimdLevel : uint8_t
+    {
+        none,
+    };
+
+    static SimdLevel detectSimdLevel()
+    {
+        return SimdLevel::none;
+    }
+#endif
+
+    static SimdLevel getSimdLevel()
+    {
+        static const auto level = detectSimdLevel();
+        return level;
+    }
+
+    static BlitRowTransparentFunc selectBlitRowTransparent()
+    {
+        switch (getSimdLevel())
+        {
+#ifdef OPENLOCO_SIMD_X86
+            case SimdLevel::avx2:
+                return blitRowTransparentAVX2;
+            case SimdLevel::sse2:
+                return blitRowTransparentSSE2;
+#endif
+            default:
+                return blitRowTransparentScalar;
+        }
+    }
+
+    static BlitRowPaletteTransparentFunc selectBlitRowPaletteTransparent()
+    {
+        switch (getSimdLevel())
+        {
+#ifdef OPENLOCO_SIMD_X86
+            case SimdLevel::avx2:
+                return blitRowPaletteTransparentAVX2;
+            case SimdLevel::sse2:
+                return blitRowPaletteTransparentSSE2;
+#endif
+            default:
+                return blitRowPaletteTransparentScalar;
+        }
+    }
+
+    void blitRowTransparent(const uint8_t* src, uint8_t* dst, size_t length)
+    {
+        static const auto func = selectBlitRowTransparent();
+        func(src, dst, length);
+    }
+
+    void blitRowPaletteTransparent(const uint8_t* src, uint8_t* dst, size_t length, const Gfx::PaletteMap::View paletteMap)
+    {
+        static const auto func = selectBlitRowPaletteTransparent();
+        func(src, dst, length, paletteMap);
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Graphics/PaletteMap.h"
+#include <cstddef>
+#include <cstdint>
+
+namespace OpenLoco::Drawing
+{
+    // Row kernels for the zoom level 0 sprite blits. The best implementation
+    // (AVX2, SSE2 or scalar) is picked at runtime on first use.
+
+    // Equivalent of blitPixel<DrawBlendOp::transparent> for a whole row
+    void blitRowTransparent(const uint8_t* src, uint8_t* dst, size_t length);
+
+    // Equivalent of blitPixel<DrawBlendOp::transparent | DrawBlendOp::src> for a whole row
+    void blitRowPaletteTransparent(const uint8_t* src, uint8_t* dst, size_t length, const Gfx::PaletteMap::View paletteMap);
+}
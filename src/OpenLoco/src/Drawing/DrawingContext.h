@@ -177,5 +177,8 @@ namespace OpenLoco::Drawing
         virtual int16_t getCurrentFontSpriteBase() = 0;
 
         virtual void setCurrentFontSpriteBase(int16_t base) = 0;
+
+        // Forgets text drawn with the previous glyphs, needed whenever g1 or the character widths are reloaded
+        virtual void clearGlyphCache() = 0;
     };
 }
@@ -0,0 +1,79 @@
+#include "ProfilerOverlay.h"
+#include "Drawing/SoftwareDrawingEngine.h"
+#include "Graphics/Colour.h"
+#include "Graphics/Gfx.h"
+#include "Localisation/Formatting.h"
+#include "Ui.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
+
+#include <stdio.h>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Drawing
+{
+    static constexpr int16_t kOverlayX = 4;
+    static constexpr int16_t kOverlayY = 20;
+    static constexpr int16_t kLineHeight = 11;
+    static constexpr int16_t kIndentWidth = 10;
+    static constexpr int16_t kTimeColumnX = 230;
+    static constexpr int16_t kOverlayWidth = 300;
+
+    static void drawLine(Gfx::RenderTarget& rt, int16_t x, int16_t y, const char* text)
+    {
+        auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
+
+        char buffer[128];
+        buffer[0] = ControlCodes::Font::bold;
+        buffer[1] = ControlCodes::Font::outline;
+        buffer[2] = ControlCodes::Colour::white;
+        snprintf(&buffer[3], std::size(buffer) - 3, "%s", text);
+
+        drawingCtx.drawString(rt, x, y, Colour::black, buffer);
+    }
+
+    // Draws the zones of the last profiled frame as a tree with the time spent in each
+    void drawProfilerOverlay()
+    {
+        auto& rt = Gfx::getScreenRT();
+        char buffer[64];
+
+        int16_t y = kOverlayY;
+        if (Profiling::isCapturing())
+        {
+            drawLine(rt, kOverlayX, y, "Recording trace...");
+            y += kLineHeight;
+        }
+
+        drawLine(rt, kOverlayX, y, "Frame");
+        snprintf(buffer, std::size(buffer), "%.2f ms", Profiling::getLastFrameDuration());
+        drawLine(rt, kOverlayX + kTimeColumnX, y, buffer);
+        y += kLineHeight;
+
+        for (const auto& zone : Profiling::getLastFrame())
+        {
+            if (y + kLineHeight > Ui::height())
+            {
+                break;
+            }
+
+            const auto x = static_cast<int16_t>(kOverlayX + (zone.depth + 1) * kIndentWidth);
+            snprintf(buffer, std::size(buffer), "%.*s", static_cast<int>(zone.name.size()), zone.name.data());
+            drawLine(rt, x, y, buffer);
+
+            if (zone.calls > 1)
+            {
+                snprintf(buffer, std::size(buffer), "%.2f ms (%u)", zone.milliseconds, zone.calls);
+            }
+            else
+            {
+                snprintf(buffer, std::size(buffer), "%.2f ms", zone.milliseconds);
+            }
+            drawLine(rt, kOverlayX + kTimeColumnX, y, buffer);
+            y += kLineHeight;
+        }
+
+        // Make area dirty so the text doesn't get drawn over the last
+        Gfx::invalidateRegion(kOverlayX, kOverlayY, kOverlayX + kOverlayWidth, y);
+    }
+}
@@ -10,6 +10,11 @@
 #include <OpenLoco/Interop/Interop.hpp>
 #include <SDL2/SDL.h>
 #include <algorithm>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Gfx;
@@ -748,6 +753,159 @@ namespace OpenLoco::Drawing
             drawImagePaletteSet(rt, pos, image.withPrimary(Colour::black), PaletteMap::View{ palette }, {});
         }
 
+        // Window redraws draw the same labels in the same colours every frame so runs of
+        // plain glyphs are rasterised once and then blitted as a single image.
+        struct GlyphRunKey
+        {
+            std::string text;
+            int16_t font;
+            PaletteMap::Buffer<8> colours;
+
+            bool operator==(const GlyphRunKey&) const = default;
+        };
+
+        struct GlyphRunKeyHash
+        {
+            size_t operator()(const GlyphRunKey& key) const
+            {
+                // FNV-1a
+                uint32_t hash = 2166136261U;
+                const auto mix = [&hash](uint8_t value) {
+                    hash = (hash ^ value) * 16777619U;
+                };
+                for (const auto chr : key.text)
+                {
+                    mix(static_cast<uint8_t>(chr));
+                }
+                mix(static_cast<uint8_t>(key.font));
+                mix(static_cast<uint8_t>(key.font >> 8));
+                for (const auto colour : key.colours)
+                {
+                    mix(colour);
+                }
+                return hash;
+            }
+        };
+
+        struct GlyphRun
+        {
+            std::vector<uint8_t> pixels;
+            G1Element element;
+            int16_t advance;
+        };
+
+        static constexpr size_t kMaxGlyphRuns = 1024;
+        // The currency object replaces this glyph when loaded (and drawPreviewImage swaps it
+        // temporarily) so it is always drawn directly rather than from a cached run.
+        static constexpr uint8_t kCurrencySymbolChar = 163;
+
+        static std::unordered_map<GlyphRunKey, GlyphRun, GlyphRunKeyHash> _glyphRunCache;
+
+        // Colour codes are the only control codes above 32 left in a formatted string
+        static bool isColourControlCode(uint8_t chr)
+        {
+            return chr >= ControlCodes::Colour::black && chr <= ControlCodes::Colour::paleSilver;
+        }
+
+        // A run stops at every control code so a colour change in a label is never baked into it
+        static bool isCachedGlyph(uint8_t chr)
+        {
+            return chr >= 32 && !isColourControlCode(chr) && chr != kCurrencySymbolChar;
+        }
+
+        static ImageId getGlyphImage(uint8_t chr, int16_t font)
+        {
+            // Use withPrimary to set imageId flag to use the correct palette code (Colour::black is not actually used)
+            return ImageId(1116 + chr - 32 + font).withPrimary(Colour::black);
+        }
+
+        static GlyphRun rasteriseGlyphRun(std::string_view text, int16_t font)
+        {
+            int32_t left = std::numeric_limits<int32_t>::max();
+            int32_t top = std::numeric_limits<int32_t>::max();
+            int32_t right = std::numeric_limits<int32_t>::min();
+            int32_t bottom = std::numeric_limits<int32_t>::min();
+
+            int32_t x = 0;
+            for (const auto c : text)
+            {
+                const auto chr = static_cast<uint8_t>(c);
+                const auto* element = getG1Element(getGlyphImage(chr, font).getIndex());
+                if (element != nullptr && element->width > 0 && element->height > 0)
+                {
+                    left = std::min<int32_t>(left, x + element->xOffset);
+                    top = std::min<int32_t>(top, element->yOffset);
+                    right = std::max<int32_t>(right, x + element->xOffset + element->width);
+                    bottom = std::max<int32_t>(bottom, element->yOffset + element->height);
+                }
+                x += _characterWidths[chr - 32 + font];
+            }
+
+            GlyphRun run{};
+            run.advance = static_cast<int16_t>(x);
+            if (left >= right || top >= bottom)
+            {
+                return run;
+            }
+
+            const auto width = right - left;
+            const auto height = bottom - top;
+            run.pixels.assign(width * height, 0);
+
+            RenderTarget runRt{};
+            runRt.bits = run.pixels.data();
+            runRt.x = static_cast<int16_t>(left);
+            runRt.y = static_cast<int16_t>(top);
+            runRt.width = static_cast<int16_t>(width);
+            runRt.height = static_cast<int16_t>(height);
+
+            x = 0;
+            for (const auto c : text)
+            {
+                const auto chr = static_cast<uint8_t>(c);
+                drawImagePaletteSet(runRt, Ui::Point(x, 0), getGlyphImage(chr, font), PaletteMap::View{ _textColours }, {});
+                x += _characterWidths[chr - 32 + font];
+            }
+
+            // Pixels the text colours map to 0 were never written so they stay transparent
+            run.element.width = static_cast<int16_t>(width);
+            run.element.height = static_cast<int16_t>(height);
+            run.element.xOffset = static_cast<int16_t>(left);
+            run.element.yOffset = static_cast<int16_t>(top);
+            run.element.flags = G1ElementFlags::hasTransparency;
+            return run;
+        }
+
+        // Draws a run of glyphs in the current font and text colours returning its advance
+        static int16_t drawGlyphRun(RenderTarget& rt, const Ui::Point& pos, std::string_view text)
+        {
+            assert(std::all_of(text.begin(), text.end(), [](char chr) { return isCachedGlyph(static_cast<uint8_t>(chr)); }));
+
+            static GlyphRunKey lookupKey{};
+            // Assigning reuses the string capacity so lookups do not allocate
+            lookupKey.text.assign(text);
+            lookupKey.font = getCurrentFontSpriteBase();
+            lookupKey.colours = _textColours;
+
+            auto it = _glyphRunCache.find(lookupKey);
+            if (it == _glyphRunCache.end())
+            {
+                if (_glyphRunCache.size() >= kMaxGlyphRuns)
+                {
+                    _glyphRunCache.clear();
+                }
+                it = _glyphRunCache.emplace(lookupKey, rasteriseGlyphRun(text, lookupKey.font)).first;
+                it->second.element.offset = it->second.pixels.data();
+            }
+
+            const auto& run = it->second;
+            if (!run.pixels.empty())
+            {
+                drawImagePaletteSet<0, false>(rt, pos, ImageId{ 0 }, run.element, PaletteMap::getDefault(), nullptr);
+            }
+            return run.advance;
+        }
+
         // 0x00451189
         static Ui::Point loopNewline(RenderTarget* rt, Ui::Point origin, const char* str)
         {
@@ -956,10 +1114,20 @@ namespace OpenLoco::Drawing
                         if (!offscreen)
                         {
                             // When offscreen in the y dimension there is no requirement to keep pos.x correct
-                            if (chr >= 32)
+                            const auto* runEnd = str - 1;
+                            while (isCachedGlyph(static_cast<uint8_t>(*runEnd)))
                             {
-                                // Use withPrimary to set imageId flag to use the correct palette code (Colour::black is not actually used)
-                                drawImagePaletteSet(*rt, pos, ImageId(1116 + chr - 32 + getCurrentFontSpriteBase()).withPrimary(Colour::black), PaletteMap::View{ _textColours }, {});
+                                runEnd++;
+                            }
+                            const auto runLength = static_cast<size_t>(runEnd - (str - 1));
+                            if (rt->zoomLevel == 0 && runLength > 1)
+                            {
+                                pos.x += drawGlyphRun(*rt, pos, std::string_view(str - 1, runLength));
+                                str = runEnd;
+                            }
+                            else if (chr >= 32)
+                            {
+                                drawImagePaletteSet(*rt, pos, getGlyphImage(chr, getCurrentFontSpriteBase()), PaletteMap::View{ _textColours }, {});
                                 pos.x += _characterWidths[chr - 32 + getCurrentFontSpriteBase()];
                             }
                             else
@@ -2377,6 +2545,11 @@ namespace OpenLoco::Drawing
                 }
             }
         }
+
+        static void clearGlyphCache()
+        {
+            _glyphRunCache.clear();
+        }
     } // Impl
 
     void SoftwareDrawingContext::clear(Gfx::RenderTarget& rt, uint32_t fill)
@@ -2544,4 +2717,9 @@ namespace OpenLoco::Drawing
         return Impl::setCurrentFontSpriteBase(base);
     }
 
+    void SoftwareDrawingContext::clearGlyphCache()
+    {
+        return Impl::clearGlyphCache();
+    }
+
 }
@@ -119,5 +119,7 @@ namespace OpenLoco::Drawing
         // 0x0112C876
         int16_t getCurrentFontSpriteBase() override;
         void setCurrentFontSpriteBase(int16_t base) override;
+
+        void clearGlyphCache() override;
     };
 }
@@ -3,6 +3,7 @@
 #include "Logging.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <SDL2/SDL.h>
 #include <algorithm>
@@ -271,6 +272,8 @@ namespace OpenLoco::Drawing
 
     void SoftwareDrawingEngine::present()
     {
+        OPENLOCO_PROFILE_SCOPE("SoftwareDrawingEngine::present");
+
         // Lock the surface before setting its pixels
         if (SDL_MUSTLOCK(_screenSurface))
         {
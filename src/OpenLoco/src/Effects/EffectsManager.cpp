@@ -1,6 +1,7 @@
 #include "EffectsManager.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 
 namespace OpenLoco::EffectsManager
 {
@@ -8,6 +9,8 @@ namespace OpenLoco::EffectsManager
     // 0x004402F4
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("EffectsManager::update");
+
         if ((getGameState().flags & GameStateFlags::tileManagerLoaded) != GameStateFlags::none)
         {
             for (auto* misc : EffectsList())
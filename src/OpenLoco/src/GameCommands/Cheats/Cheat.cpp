@@ -13,6 +13,7 @@
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
@@ -73,6 +74,7 @@ namespace OpenLoco::GameCommands
                     component.owner = ourCompanyId;
                 });
             }
+            CompanyOwnership::invalidate();
 
             return 0;
         }
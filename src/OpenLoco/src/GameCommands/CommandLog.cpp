@@ -0,0 +1,290 @@
+#include "CommandLog.h"
+#include "GameState.h"
+#include "Logging.h"
+#include "Network/Network.h"
+#include "S5/S5.h"
+#include "ScenarioManager.h"
+#include "SceneManager.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <array>
+#include <memory>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::GameCommands::CommandLog
+{
+    static constexpr uint32_t kMagic = 0x4C43474F; // OGCL
+    static constexpr uint16_t kVersion = 1;
+
+    // Ticks between checkpoints, checksums of the whole state are only taken every few of them
+    static constexpr uint32_t kCheckpointInterval = 32;
+    static constexpr uint32_t kChecksumInterval = kCheckpointInterval * 16;
+
+    enum class RecordKind : uint8_t
+    {
+        command,
+        checkpoint,
+    };
+
+#pragma pack(push, 1)
+    struct LogHeader
+    {
+        uint32_t magic;
+        uint16_t version;
+        uint32_t startTick;
+    };
+
+    struct CommandRecord
+    {
+        uint32_t tick;
+        GameCommand command;
+        CompanyId company;
+        std::array<int32_t, 7> regs; // eax, ebx, ecx, edx, esi, edi, ebp
+    };
+
+    struct CheckpointRecord
+    {
+        uint32_t tick;
+        uint32_t srand0;
+        uint32_t srand1;
+        uint8_t hasChecksums;
+        Network::StateChecksums checksums;
+    };
+#pragma pack(pop)
+
+    static std::optional<fs::path> _pendingPath;
+    static std::unique_ptr<FileStream> _file;
+    static uint32_t _startTick = 0;
+    static uint32_t _lastTick = 0;
+    static bool _isInTick = false;
+
+    fs::path getSavePath(const fs::path& logPath)
+    {
+        auto savePath = logPath;
+        savePath += S5::extensionSV5;
+        return savePath;
+    }
+
+    Checkpoint createCheckpoint(bool withChecksums)
+    {
+        const auto& rng = getGameState().rng;
+        Checkpoint checkpoint{ ScenarioManager::getScenarioTicks(), rng.srand_0(), rng.srand_1(), std::nullopt };
+        if (withChecksums)
+        {
+            checkpoint.checksums = Network::computeStateChecksums();
+        }
+        return checkpoint;
+    }
+
+    bool verifyCheckpoint(const Checkpoint& expected)
+    {
+        const auto actual = createCheckpoint(expected.checksums.has_value());
+
+        bool matches = true;
+        if (actual.srand0 != expected.srand0 || actual.srand1 != expected.srand1)
+        {
+            Logging::error("Tick {}: prng is {:08X} {:08X}, expected {:08X} {:08X}", expected.tick, actual.srand0, actual.srand1, expected.srand0, expected.srand1);
+            matches = false;
+        }
+        if (expected.checksums.has_value())
+        {
+            for (size_t i = 0; i < expected.checksums->values.size(); i++)
+            {
+                const auto kind = static_cast<Network::StateChecksumKind>(i);
+                if (actual.checksums->get(kind) != expected.checksums->get(kind))
+                {
+                    Logging::error("Tick {}: {} checksum is {:08X}, expected {:08X}", expected.tick, Network::getStateChecksumName(kind), actual.checksums->get(kind), expected.checksums->get(kind));
+                    matches = false;
+                }
+            }
+        }
+        return matches;
+    }
+
+    static void writeCheckpoint(bool withChecksums)
+    {
+        const auto checkpoint = createCheckpoint(withChecksums);
+
+        CheckpointRecord record{};
+        record.tick = checkpoint.tick;
+        record.srand0 = checkpoint.srand0;
+        record.srand1 = checkpoint.srand1;
+        record.hasChecksums = checkpoint.checksums.has_value() ? 1 : 0;
+        if (checkpoint.checksums.has_value())
+        {
+            record.checksums = *checkpoint.checksums;
+        }
+
+        _file->writeValue(RecordKind::checkpoint);
+        _file->writeValue(record);
+    }
+
+    static void closeFile()
+    {
+        _file.reset();
+        _pendingPath = std::nullopt;
+    }
+
+    static bool canRecord()
+    {
+        return !isTitleMode() && !isEditorMode() && !Network::isConnected();
+    }
+
+    static void beginFile(const fs::path& path)
+    {
+        const auto tick = ScenarioManager::getScenarioTicks();
+        try
+        {
+            const auto savePath = getSavePath(path);
+            if (!S5::exportGameStateToFile(savePath, S5::SaveFlags::packCustomObjects | S5::SaveFlags::noWindowClose))
+            {
+                throw Exception::RuntimeError("Unable to write the starting save.");
+            }
+
+            _file = std::make_unique<FileStream>(path, StreamMode::write);
+            _file->writeValue(LogHeader{ kMagic, kVersion, tick });
+            _startTick = tick;
+            _lastTick = tick;
+            writeCheckpoint(true);
+            Logging::info("Recording game commands to '{}' from tick {}", path, tick);
+        }
+        catch (const std::exception& e)
+        {
+            Logging::error("Unable to record game commands to '{}': {}", path, e.what());
+            _file.reset();
+        }
+    }
+
+    void startRecording(const fs::path& path)
+    {
+        stopRecording();
+        _pendingPath = path;
+    }
+
+    void stopRecording()
+    {
+        // Unless another game has been loaded since the last tick
+        if (_file != nullptr && canRecord() && ScenarioManager::getScenarioTicks() == _lastTick + 1)
+        {
+            writeCheckpoint(true);
+        }
+        closeFile();
+    }
+
+    bool isRecording()
+    {
+        return _file != nullptr;
+    }
+
+    void beginTick()
+    {
+        _isInTick = true;
+
+        if (_pendingPath.has_value() && _file == nullptr)
+        {
+            if (canRecord())
+            {
+                const auto path = *_pendingPath;
+                _pendingPath = std::nullopt;
+                beginFile(path);
+            }
+            return;
+        }
+        if (_file == nullptr)
+        {
+            return;
+        }
+
+        // A different game has been loaded, what was recorded so far is still valid up to the last checkpoint
+        const auto tick = ScenarioManager::getScenarioTicks();
+        if (!canRecord() || tick != _lastTick + 1)
+        {
+            Logging::info("Game command recording ended at tick {}", _lastTick);
+            closeFile();
+            return;
+        }
+
+        // Checkpoint of the state before this tick, after the commands issued since the last one
+        const auto elapsed = tick - _startTick;
+        if (elapsed % kCheckpointInterval == 0)
+        {
+            writeCheckpoint(elapsed % kChecksumInterval == 0);
+        }
+        _lastTick = tick;
+    }
+
+    void endTick()
+    {
+        _isInTick = false;
+    }
+
+    void recordCommand(GameCommand command, CompanyId company, const registers& regs)
+    {
+        if (_file == nullptr || _isInTick)
+        {
+            return;
+        }
+
+        CommandRecord record{};
+        record.tick = ScenarioManager::getScenarioTicks();
+        record.command = command;
+        record.company = company;
+        record.regs = { regs.eax, regs.ebx, regs.ecx, regs.edx, regs.esi, regs.edi, regs.ebp };
+
+        _file->writeValue(RecordKind::command);
+        _file->writeValue(record);
+    }
+
+    Log readLog(const fs::path& path)
+    {
+        FileStream fs(path, StreamMode::read);
+
+        const auto header = fs.readValue<LogHeader>();
+        if (header.magic != kMagic)
+            throw Exception::RuntimeError("Not a game command log.");
+        if (header.version != kVersion)
+            throw Exception::RuntimeError("Unsupported game command log version.");
+
+        Log log;
+        log.startTick = header.startTick;
+        while (fs.getPosition() < fs.getLength())
+        {
+            const auto remaining = fs.getLength() - fs.getPosition();
+            const auto kind = fs.readValue<RecordKind>();
+            if (kind == RecordKind::command && remaining > sizeof(CommandRecord))
+            {
+                const auto record = fs.readValue<CommandRecord>();
+                registers regs;
+                regs.eax = record.regs[0];
+                regs.ebx = record.regs[1];
+                regs.ecx = record.regs[2];
+                regs.edx = record.regs[3];
+                regs.esi = record.regs[4];
+                regs.edi = record.regs[5];
+                regs.ebp = record.regs[6];
+                log.commands.push_back(LoggedCommand{ record.tick, record.command, record.company, regs });
+            }
+            else if (kind == RecordKind::checkpoint && remaining > sizeof(CheckpointRecord))
+            {
+                const auto record = fs.readValue<CheckpointRecord>();
+                Checkpoint checkpoint{ record.tick, record.srand0, record.srand1, std::nullopt };
+                if (record.hasChecksums != 0)
+                {
+                    checkpoint.checksums = record.checksums;
+                }
+                log.checkpoints.push_back(checkpoint);
+            }
+            else
+            {
+                // Unknown or partially written record, usually the end of an interrupted recording
+                break;
+            }
+        }
+
+        if (log.checkpoints.empty())
+            throw Exception::RuntimeError("Game command log has no checkpoints.");
+
+        return log;
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "GameCommands.h"
+#include "Network/StateChecksum.h"
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <optional>
+#include <vector>
+
+/**
+ * Records the game commands the player issues along with periodic checkpoints of the game state
+ * so that a session can be replayed headlessly from its starting save, both as a repeatable
+ * benchmark and to detect desyncs.
+ */
+namespace OpenLoco::GameCommands::CommandLog
+{
+    struct LoggedCommand
+    {
+        uint32_t tick;
+        GameCommand command;
+        CompanyId company;
+        registers regs;
+    };
+
+    struct Checkpoint
+    {
+        uint32_t tick;
+        uint32_t srand0;
+        uint32_t srand1;
+        // Only taken every so often as they are expensive to compute
+        std::optional<Network::StateChecksums> checksums;
+    };
+
+    struct Log
+    {
+        uint32_t startTick{};
+        std::vector<LoggedCommand> commands;
+        std::vector<Checkpoint> checkpoints;
+    };
+
+    // Recording starts with the next tick of a game in progress, which also writes the starting save.
+    void startRecording(const fs::path& path);
+    void stopRecording();
+    bool isRecording();
+
+    // Commands issued between these are part of the simulation (e.g. AI) and are not recorded.
+    void beginTick();
+    void endTick();
+
+    void recordCommand(GameCommand command, CompanyId company, const registers& regs);
+
+    // Save the recording started from, written next to the log.
+    fs::path getSavePath(const fs::path& logPath);
+    // Throws if the log can not be read, a log cut short (e.g. by a crash) ends at the last full record.
+    Log readLog(const fs::path& path);
+
+    Checkpoint createCheckpoint(bool withChecksums);
+    // Logs the differences and returns false if the current state does not match.
+    bool verifyCheckpoint(const Checkpoint& expected);
+}
@@ -4,6 +4,7 @@
 #include "Buildings/CreateBuilding.h"
 #include "Buildings/RemoveBuilding.h"
 #include "Cheats/Cheat.h"
+#include "CommandLog.h"
 #include "Company/BuildCompanyHeadquarters.h"
 #include "Company/ChangeCompanyColour.h"
 #include "Company/ChangeCompanyFace.h"
@@ -27,6 +28,7 @@
 #include "Map/StationElement.h"
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
+#include "Map/Track/TrackData.h"
 #include "Map/TrackElement.h"
 #include "Network/Network.h"
 #include "Objects/ObjectManager.h"
@@ -65,6 +67,8 @@
 #include "Vehicles/CloneVehicle.h"
 #include "Vehicles/CreateVehicle.h"
 #include "Vehicles/RenameVehicle.h"
+#include "Vehicles/TrackOccupancy.h"
+#include "Vehicles/TrackPathfinding.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleChangeRunningMode.h"
 #include "Vehicles/VehicleOrderDelete.h"
@@ -87,7 +91,9 @@
 #include "Vehicles/VehicleSpeedControl.h"
 #include "World/Company.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/StationManager.h"
+#include "World/TownManager.h"
 #include <cassert>
 
 using namespace OpenLoco::Ui;
@@ -284,6 +290,7 @@ namespace OpenLoco::GameCommands
             return loc_4313C6(esi, copyRegs);
         }
 
+        CommandLog::recordCommand(command, _updatingCompanyId, regs);
         return doCommandForReal(command, _updatingCompanyId, regs);
     }
 
@@ -341,6 +348,112 @@ namespace OpenLoco::GameCommands
         }
     }
 
+    // Drops the cached signal blocks (see Vehicles::sub_4A2A58) and the track between junctions
+    // (see Vehicles::TrackPathfinding) that a command may change
+    static void invalidateTrackCaches(GameCommand command, const registers& regs)
+    {
+        switch (command)
+        {
+            case GameCommand::createTrack:
+            case GameCommand::removeTrack:
+            case GameCommand::createSignal:
+            case GameCommand::removeSignal:
+                // All of these take the track position in ax, cx
+                Vehicles::invalidateSignalBlocks(World::Pos2(regs.ax, regs.cx));
+                Vehicles::TrackPathfinding::invalidate(World::Pos2(regs.ax, regs.cx));
+                break;
+            case GameCommand::createTrainStation:
+            case GameCommand::removeTrainStation:
+            case GameCommand::createTrackMod:
+            case GameCommand::removeTrackMod:
+            case GameCommand::createRoad:
+            case GameCommand::removeRoad:
+                // Stations, mods and level crossings only matter to the route choice, all take the position in ax, cx
+                Vehicles::TrackPathfinding::invalidate(World::Pos2(regs.ax, regs.cx));
+                break;
+            case GameCommand::clearLand:
+            case GameCommand::gc_unk_34:
+            case GameCommand::gc_unk_51:
+            case GameCommand::gc_unk_52:
+            case GameCommand::gc_unk_53:
+            case GameCommand::loadMultiplayerMap:
+            case GameCommand::gc_unk_68:
+            case GameCommand::gc_unk_69:
+            case GameCommand::gc_unk_70:
+            case GameCommand::cheat:
+                Vehicles::invalidateAllSignalBlocks();
+                Vehicles::TrackPathfinding::invalidateAll();
+                break;
+            default:
+                break;
+        }
+    }
+
+    // Tiles covered by a track or road piece whose element at the given sequence index is at pos
+    template<typename TFunc>
+    static void forEachPieceTile(std::span<const World::TrackData::PreviewTrack> pieces, const World::Pos3& pos, uint8_t rotation, uint8_t index, TFunc&& func)
+    {
+        if (index >= pieces.size())
+        {
+            return;
+        }
+        const auto origin = World::Pos2(pos) - Math::Vector::rotate(World::Pos2(pieces[index].x, pieces[index].y), rotation);
+        for (const auto& piece : pieces)
+        {
+            func(World::toTileSpace(origin + Math::Vector::rotate(World::Pos2(piece.x, piece.y), rotation)));
+        }
+    }
+
+    // Keeps the company ownership index and the town building registry up to date with what a command
+    // has built or removed
+    static void updateAssetIndices(GameCommand command, const registers& regs)
+    {
+        const auto company = getUpdatingCompanyId();
+        switch (command)
+        {
+            case GameCommand::createBuilding:
+            {
+                const BuildingPlacementArgs args(regs);
+                TownManager::registerBuilding(args.pos);
+                break;
+            }
+            case GameCommand::createTrack:
+            {
+                const TrackPlacementArgs args(regs);
+                forEachPieceTile(World::TrackData::getTrackPiece(args.trackId), args.pos, args.rotation, 0, [company](const World::TilePos2& pos) {
+                    CompanyOwnership::addTile(company, pos);
+                });
+                break;
+            }
+            case GameCommand::removeTrack:
+            {
+                const TrackRemovalArgs args(regs);
+                forEachPieceTile(World::TrackData::getTrackPiece(args.trackId), args.pos, args.rotation, args.index, [company](const World::TilePos2& pos) {
+                    CompanyOwnership::removeTile(company, pos);
+                });
+                break;
+            }
+            case GameCommand::createRoad:
+            {
+                const RoadPlacementArgs args(regs);
+                forEachPieceTile(World::TrackData::getRoadPiece(args.roadId), args.pos, args.rotation, 0, [company](const World::TilePos2& pos) {
+                    CompanyOwnership::addTile(company, pos);
+                });
+                break;
+            }
+            case GameCommand::removeRoad:
+            {
+                const RoadRemovalArgs args(regs);
+                forEachPieceTile(World::TrackData::getRoadPiece(args.roadId), args.pos, args.unkDirection, args.sequenceIndex, [company](const World::TilePos2& pos) {
+                    CompanyOwnership::removeTile(company, pos);
+                });
+                break;
+            }
+            default:
+                break;
+        }
+    }
+
     static uint32_t loc_4313C6(int esi, const registers& regs)
     {
         uint16_t flags = regs.bx;
@@ -394,7 +507,12 @@ namespace OpenLoco::GameCommands
 
         uint16_t flagsBackup2 = _gameCommandFlags;
         registers fnRegs2 = regs;
+        // Before as well as after as the command can walk the track part way through changing it
+        invalidateTrackCaches(static_cast<GameCommand>(esi), regs);
+        Vehicles::TrackOccupancy::invalidate();
         callGameCommandFunction(esi, fnRegs2);
+        invalidateTrackCaches(static_cast<GameCommand>(esi), regs);
+        Vehicles::TrackOccupancy::invalidate();
         int32_t ebx2 = fnRegs2.ebx;
         _gameCommandFlags = flagsBackup2;
 
@@ -402,6 +520,7 @@ namespace OpenLoco::GameCommands
         {
             return loc_4314EA();
         }
+        updateAssetIndices(static_cast<GameCommand>(esi), regs);
 
         if (isEditorMode())
         {
@@ -36,7 +36,7 @@ namespace OpenLoco::GameCommands
      * This is called when you activate the Plant Trees from the construction menu and you move the cursor over the terrain.
      *
      */
-    static uint32_t createTree(const TreePlacementArgs& args, const uint8_t flags)
+    uint32_t createTree(const TreePlacementArgs& args, const uint8_t flags)
     {
         setExpenditureType(ExpenditureType::Construction);
 
@@ -41,5 +41,8 @@ namespace OpenLoco::GameCommands
         }
     };
 
+    // Builds the tree without going through doCommand. Only valid in the editor where doCommand does no
+    // payment or cost handling, otherwise use the game command. Returns the cost or FAILURE like the game command.
+    uint32_t createTree(const TreePlacementArgs& args, const uint8_t flags);
     void createTree(registers& regs);
 }
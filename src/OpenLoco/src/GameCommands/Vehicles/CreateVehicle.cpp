@@ -23,6 +23,7 @@
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/Station.h"
 #include <numeric>
 #include <optional>
@@ -462,6 +463,7 @@ namespace OpenLoco::GameCommands
         newHead->lastAverageSpeed = 0_mph;
         newHead->var_79 = 0;
         sub_470312(newHead);
+        CompanyOwnership::addVehicle(*newHead);
         return newHead;
     }
 
@@ -685,6 +687,7 @@ namespace OpenLoco::GameCommands
                 }
                 auto tail = veh2->nextVehicleComponent();
                 // Get all vehicles before freeing
+                CompanyOwnership::removeVehicle(*_head);
                 EntityManager::freeEntity(_head);
                 EntityManager::freeEntity(veh1);
                 EntityManager::freeEntity(veh2);
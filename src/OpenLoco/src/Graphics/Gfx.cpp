@@ -11,13 +11,16 @@
 #include "Localisation/StringManager.h"
 #include "Logging.h"
 #include "PaletteMap.h"
+#include "Paint/Paint.h"
 #include "Ui.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Core/Stream.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Platform/Platform.h>
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -36,6 +39,7 @@ namespace OpenLoco::Gfx
     static loco_global<G1Element[G1ExpectedCount::kDisc + kG1CountTemporary + G1ExpectedCount::kObjects], 0x9E2424> _g1Elements;
 
     static std::unique_ptr<std::byte[]> _g1Buffer;
+    static std::unique_ptr<Platform::MappedFile> _g1File;
 
     static loco_global<uint8_t[224 * 4], 0x112C884> _characterWidths;
 
@@ -64,22 +68,8 @@ namespace OpenLoco::Gfx
         return elements;
     }
 
-    // 0x0044733C
-    void loadG1()
+    static void logG1ElementCount(const G1Header& header)
     {
-        auto g1Path = Environment::getPath(Environment::PathId::g1);
-        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
-        if (!stream)
-        {
-            throw Exception::RuntimeError("Opening g1 file failed.");
-        }
-
-        G1Header header;
-        if (!readData(stream, header))
-        {
-            throw Exception::RuntimeError("Reading g1 file header failed.");
-        }
-
         if (header.numEntries != G1ExpectedCount::kDisc)
         {
             if (header.numEntries == G1ExpectedCount::kSteam)
@@ -91,23 +81,12 @@ namespace OpenLoco::Gfx
                 Logging::warn("G1 element count doesn't match expected value:\nExpected {}; Got {}", G1ExpectedCount::kDisc, header.numEntries);
             }
         }
+    }
 
-        // Read element headers
-        auto elements32 = std::vector<G1Element32>(header.numEntries);
-        if (!readData(stream, elements32.data(), header.numEntries))
-        {
-            throw Exception::RuntimeError("Reading g1 element headers failed.");
-        }
-        auto elements = convertElements(elements32);
-
-        // Read element data
-        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
-        if (!readData(stream, elementData.get(), header.totalSize))
-        {
-            throw Exception::RuntimeError("Reading g1 elements failed.");
-        }
-        stream.close();
-
+    // Fixes up the element headers and points them at elementData. Only the headers are touched
+    // so the pixel data can stay in a read-only or lazily loaded buffer.
+    static void setG1Elements(const G1Header& header, std::vector<G1Element> elements, std::byte* elementData)
+    {
         // The steam G1.DAT is missing two localised tutorial icons, and a smaller font variant
         // This code copies the closest variants into their place, and moves other elements accordingly
         if (header.numEntries == G1ExpectedCount::kSteam)
@@ -144,13 +123,98 @@ namespace OpenLoco::Gfx
         // Adjust memory offsets
         for (auto& element : elements)
         {
-            element.offset += (uintptr_t)elementData.get();
+            element.offset += (uintptr_t)elementData;
         }
 
-        _g1Buffer = std::move(elementData);
         std::copy(elements.begin(), elements.end(), _g1Elements.get());
     }
 
+    // Maps g1.dat instead of reading it so that the pixel data of an element is only loaded from
+    // disk when the sprite is first drawn. Returns false if the file could not be mapped.
+    static bool loadG1Mapped(const fs::path& g1Path)
+    {
+        auto file = std::make_unique<Platform::MappedFile>();
+        if (!file->open(g1Path))
+        {
+            return false;
+        }
+
+        auto data = file->data();
+        G1Header header;
+        if (data.size() < sizeof(header))
+        {
+            throw Exception::RuntimeError("Reading g1 file header failed.");
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        logG1ElementCount(header);
+
+        const auto headersSize = static_cast<size_t>(header.numEntries) * sizeof(G1Element32);
+        if (data.size() - sizeof(header) < headersSize)
+        {
+            throw Exception::RuntimeError("Reading g1 element headers failed.");
+        }
+        if (data.size() - sizeof(header) - headersSize < header.totalSize)
+        {
+            throw Exception::RuntimeError("Reading g1 elements failed.");
+        }
+
+        auto elements32 = std::vector<G1Element32>(header.numEntries);
+        std::memcpy(elements32.data(), data.data() + sizeof(header), headersSize);
+
+        setG1Elements(header, convertElements(elements32), data.data() + sizeof(header) + headersSize);
+
+        _g1Buffer.reset();
+        _g1File = std::move(file);
+        return true;
+    }
+
+    static void loadG1Stream(const fs::path& g1Path)
+    {
+        std::ifstream stream(g1Path, std::ios::in | std::ios::binary);
+        if (!stream)
+        {
+            throw Exception::RuntimeError("Opening g1 file failed.");
+        }
+
+        G1Header header;
+        if (!readData(stream, header))
+        {
+            throw Exception::RuntimeError("Reading g1 file header failed.");
+        }
+        logG1ElementCount(header);
+
+        // Read element headers
+        auto elements32 = std::vector<G1Element32>(header.numEntries);
+        if (!readData(stream, elements32.data(), header.numEntries))
+        {
+            throw Exception::RuntimeError("Reading g1 element headers failed.");
+        }
+
+        // Read element data
+        auto elementData = std::make_unique<std::byte[]>(header.totalSize);
+        if (!readData(stream, elementData.get(), header.totalSize))
+        {
+            throw Exception::RuntimeError("Reading g1 elements failed.");
+        }
+        stream.close();
+
+        setG1Elements(header, convertElements(elements32), elementData.get());
+
+        _g1File.reset();
+        _g1Buffer = std::move(elementData);
+    }
+
+    // 0x0044733C
+    void loadG1()
+    {
+        auto g1Path = Environment::getPath(Environment::PathId::g1);
+        if (!loadG1Mapped(g1Path))
+        {
+            Logging::verbose("Unable to map g1 file, reading it instead.");
+            loadG1Stream(g1Path);
+        }
+    }
+
     // 0x004949BC
     void initialiseCharacterWidths()
     {
@@ -188,6 +252,7 @@ namespace OpenLoco::Gfx
                 _characterWidths[font.offset + i] = width;
             }
         }
+        getDrawingEngine().getDrawingContext().clearGlyphCache();
         // Vanilla setup scrolling text related globals here (unused)
     }
 
@@ -200,6 +265,7 @@ namespace OpenLoco::Gfx
     // 0x004CD406
     void invalidateScreen()
     {
+        Paint::invalidateStaticLayerCache();
         invalidateRegion(0, 0, Ui::width(), Ui::height());
     }
 
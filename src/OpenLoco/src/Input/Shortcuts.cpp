@@ -1,11 +1,14 @@
 #include "Shortcuts.h"
+#include "Config.h"
 #include "GameCommands/GameCommands.h"
 #include "GameCommands/General/SetGameSpeed.h"
 #include "GameCommands/General/TogglePause.h"
+#include "Graphics/Gfx.h"
 #include "Input.h"
 #include "LastGameOptionManager.h"
 #include "Localisation/FormatArguments.hpp"
 #include "Localisation/StringIds.h"
+#include "Logging.h"
 #include "S5/S5.h"
 #include "SceneManager.h"
 #include "Ui/Screenshot.h"
@@ -16,13 +19,17 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Engine/Input/ShortcutManager.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Platform/Platform.h>
 #include <array>
+#include <fstream>
 #include <unordered_map>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::Input::Shortcuts
 {
@@ -546,6 +553,37 @@ namespace OpenLoco::Input::Shortcuts
         GameCommands::doCommand(GameCommands::SetGameSpeedArgs{ GameSpeed::ExtraFastForward }, GameCommands::Flags::apply);
     }
 
+    static void toggleProfilerOverlay()
+    {
+        auto& cfg = Config::get();
+        cfg.showProfiler ^= true;
+        Config::write();
+
+        Gfx::invalidateScreen();
+    }
+
+    static void recordProfilerTrace()
+    {
+        if (!Profiling::isCapturing())
+        {
+            Profiling::beginCapture();
+            Logging::info("Recording profiler trace");
+            return;
+        }
+
+        const auto path = Platform::getUserDirectory() / "profile.json";
+        std::ofstream outputStream(path, std::ios::out | std::ios::binary);
+        Profiling::endCapture(outputStream);
+        if (outputStream)
+        {
+            Logging::info("Profiler trace written to {}", path);
+        }
+        else
+        {
+            Logging::error("Unable to write profiler trace to {}", path);
+        }
+    }
+
     void initialize()
     {
         // clang-format off
@@ -599,6 +637,8 @@ namespace OpenLoco::Input::Shortcuts
         ShortcutManager::add(Shortcut::gameSpeedNormal,                 StringIds::shortcut_game_speed_normal,                  gameSpeedNormal,                "gameSpeedNormal",                  "");
         ShortcutManager::add(Shortcut::gameSpeedFastForward,            StringIds::shortcut_game_speed_fast_forward,            gameSpeedFastForward,           "gameSpeedFastForward",             "");
         ShortcutManager::add(Shortcut::gameSpeedExtraFastForward,       StringIds::shortcut_game_speed_extra_fast_forward,      gameSpeedExtraFastForward,      "gameSpeedExtraFastForward",        "");
+        ShortcutManager::add(Shortcut::toggleProfilerOverlay,           StringIds::shortcutToggleProfilerOverlay,               toggleProfilerOverlay,          "toggleProfilerOverlay",            "");
+        ShortcutManager::add(Shortcut::recordProfilerTrace,             StringIds::shortcutRecordProfilerTrace,                 recordProfilerTrace,            "recordProfilerTrace",              "");
         // clang-format on
     }
 }
@@ -56,6 +56,8 @@ namespace OpenLoco::Input
         gameSpeedNormal,
         gameSpeedFastForward,
         gameSpeedExtraFastForward,
+        toggleProfilerOverlay,
+        recordProfilerTrace,
     };
 
     namespace Shortcuts
@@ -35,6 +35,7 @@
 #include "Ui.h"
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
+#include "Vehicles/TrackPathfinding.h"
 #include "Vehicles/Vehicle.h"
 #include "ViewportManager.h"
 #include "Widget.h"
@@ -804,6 +805,7 @@ void OpenLoco::Interop::registerHooks()
     Paint::registerHooks();
     Config::registerHooks();
     ObjectManager::registerHooks();
+    Vehicles::TrackPathfinding::registerHooks();
 
     // Part of 0x004691FA
     registerHook(
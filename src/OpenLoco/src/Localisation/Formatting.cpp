@@ -201,6 +201,13 @@ namespace OpenLoco::StringManager
 
     static char* formatStringPart(char* buffer, const char* sourceStr, void* args);
 
+    static const CurrencyObject* _currencyOverride = nullptr;
+
+    void setCurrencyOverride(const CurrencyObject* currency)
+    {
+        _currencyOverride = currency;
+    }
+
     static char* formatCurrency(int64_t value, char* buffer)
     {
         if (value < 0)
@@ -210,7 +217,7 @@ namespace OpenLoco::StringManager
             value = -value;
         }
 
-        CurrencyObject* currency = ObjectManager::get<CurrencyObject>();
+        const CurrencyObject* currency = _currencyOverride != nullptr ? _currencyOverride : ObjectManager::get<CurrencyObject>();
 
         int64_t localisedValue = value * (1ULL << currency->factor);
 
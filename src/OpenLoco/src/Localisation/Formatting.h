@@ -127,6 +127,7 @@ namespace OpenLoco
 namespace OpenLoco
 {
     enum class MonthId : uint8_t;
+    struct CurrencyObject;
 }
 
 namespace OpenLoco::StringManager
@@ -141,6 +142,10 @@ namespace OpenLoco::StringManager
 
     std::pair<StringId, StringId> monthToString(MonthId month);
 
+    // Formats amounts of money with the given currency rather than the loaded one until reset
+    // with nullptr, e.g. for a scenario that is not the one loaded.
+    void setCurrencyOverride(const CurrencyObject* currency);
+
     int32_t internalLengthToComma1DP(const int32_t length);
     size_t locoStrlen(const char* buffer);
     size_t locoStrlenS(const char* buffer, std::size_t size);
@@ -8,7 +8,11 @@
 #include "StringManager.h"
 #include "Ui.h"
 #include "Unicode.h"
+#include <OpenLoco/Core/BinaryStream.h>
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Core/Timer.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Platform.h>
 #include <cassert>
@@ -24,6 +28,35 @@ namespace OpenLoco::Localisation
     static loco_global<char* [0xFFFF], 0x005183FC> _strings;
     static std::vector<std::unique_ptr<char[]>> _stringsOwner;
 
+    // Bump whenever readString changes what it produces so stale caches are rebuilt
+    static constexpr uint32_t kLanguageCacheMagic = 0x43474C4F; // OLGC
+    static constexpr uint32_t kLanguageCacheVersion = 1;
+
+#pragma pack(push, 1)
+    struct LanguageCacheHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint64_t sourceSize;
+        int64_t sourceWriteTime;
+        uint32_t sourcePathLength;
+        uint32_t numStrings;
+    };
+
+    struct LanguageCacheEntry
+    {
+        StringId id;
+        uint32_t length;
+    };
+#pragma pack(pop)
+
+    struct ProcessedString
+    {
+        StringId id;
+        const char* str;
+        size_t length;
+    };
+
     static const std::map<std::string, uint8_t, std::less<>> kBasicCommands = {
         { "INT16_1DP", ControlCodes::int16_decimals },
         { "INT32_2DP", ControlCodes::int32_decimals },
@@ -56,7 +89,8 @@ namespace OpenLoco::Localisation
         { "GREEN", ControlCodes::Colour::green },
     };
 
-    static std::unique_ptr<char[]> readString(const char* value, size_t size)
+    // Length includes the terminating NULL, strings can have NULL bytes within inline arguments.
+    static std::pair<std::unique_ptr<char[]>, size_t> readString(const char* value, size_t size)
     {
         // Take terminating NULL character in account
         auto str = std::make_unique<char[]>(size + 1);
@@ -225,7 +259,8 @@ namespace OpenLoco::Localisation
                 break;
         }
 
-        return str;
+        const auto length = static_cast<size_t>(out - str.get());
+        return { std::move(str), length };
     }
 
     static bool stringIsBuffer(int id)
@@ -245,13 +280,131 @@ namespace OpenLoco::Localisation
         }
     }
 
+    static fs::path getLanguageCachePath(const fs::path& languageFile)
+    {
+        auto cacheFile = languageFile.filename();
+        cacheFile.replace_extension(".bin");
+        return Platform::getUserDirectory() / "cache" / "language" / cacheFile;
+    }
+
+    static LanguageCacheHeader getLanguageCacheHeader(const fs::path& languageFile, uint32_t numStrings)
+    {
+        LanguageCacheHeader header{};
+        header.magic = kLanguageCacheMagic;
+        header.version = kLanguageCacheVersion;
+        header.sourceSize = fs::file_size(languageFile);
+        header.sourceWriteTime = fs::last_write_time(languageFile).time_since_epoch().count();
+        header.sourcePathLength = static_cast<uint32_t>(languageFile.u8string().size());
+        header.numStrings = numStrings;
+        return header;
+    }
+
+    // The whole cache is read at once and kept alive, the string table points straight into it.
+    static bool tryLoadLanguageCache(const fs::path& languageFile)
+    {
+        Core::Timer loadTimer;
+
+        const auto cachePath = getLanguageCachePath(languageFile);
+        if (!fs::exists(cachePath))
+        {
+            return false;
+        }
+
+        try
+        {
+            std::unique_ptr<char[]> data;
+            size_t length = 0;
+            {
+                FileStream fs(cachePath, StreamMode::read);
+                length = fs.getLength();
+                data = std::make_unique<char[]>(length);
+                fs.read(data.get(), length);
+            }
+
+            BinaryStream stream(data.get(), length);
+            const auto header = stream.readValue<LanguageCacheHeader>();
+            const auto expected = getLanguageCacheHeader(languageFile, header.numStrings);
+            const auto sourcePath = languageFile.u8string();
+            if (header.magic != expected.magic || header.version != expected.version
+                || header.sourceSize != expected.sourceSize || header.sourceWriteTime != expected.sourceWriteTime
+                || header.sourcePathLength != expected.sourcePathLength
+                || stream.getLength() - stream.getPosition() < header.sourcePathLength
+                || sourcePath.compare(0, sourcePath.size(), data.get() + stream.getPosition(), header.sourcePathLength) != 0)
+            {
+                Logging::verbose("Language cache for '{}' out of date.", languageFile);
+                return false;
+            }
+            stream.setPosition(stream.getPosition() + header.sourcePathLength);
+
+            std::vector<std::pair<StringId, char*>> table;
+            table.reserve(header.numStrings);
+            for (uint32_t i = 0; i < header.numStrings; i++)
+            {
+                const auto entry = stream.readValue<LanguageCacheEntry>();
+                if (entry.length == 0 || stream.getLength() - stream.getPosition() < entry.length)
+                {
+                    throw Exception::RuntimeError("Truncated string table.");
+                }
+                table.emplace_back(entry.id, data.get() + stream.getPosition());
+                stream.setPosition(stream.getPosition() + entry.length);
+            }
+
+            // Only touch the string table once the whole cache is known to be good
+            for (const auto& [id, str] : table)
+            {
+                _strings[id] = str;
+            }
+            _stringsOwner.emplace_back(std::move(data));
+
+            Logging::verbose("Loaded language cache for '{}' in {} milliseconds.", languageFile, loadTimer.elapsed());
+            return true;
+        }
+        catch (const std::exception& e)
+        {
+            Logging::warn("Unable to load language cache '{}': {}", cachePath, e.what());
+            return false;
+        }
+    }
+
+    static void saveLanguageCache(const fs::path& languageFile, const std::vector<ProcessedString>& table)
+    {
+        const auto cachePath = getLanguageCachePath(languageFile);
+        try
+        {
+            MemoryStream stream;
+            stream.writeValue(getLanguageCacheHeader(languageFile, static_cast<uint32_t>(table.size())));
+            const auto sourcePath = languageFile.u8string();
+            stream.write(sourcePath.data(), sourcePath.size());
+            for (const auto& processed : table)
+            {
+                stream.writeValue(LanguageCacheEntry{ processed.id, static_cast<uint32_t>(processed.length) });
+                stream.write(processed.str, processed.length);
+            }
+
+            Environment::autoCreateDirectory(cachePath.parent_path());
+            FileStream fs(cachePath, StreamMode::write);
+            fs.write(stream.data(), stream.getLength());
+        }
+        catch (const std::exception& e)
+        {
+            // Next start will just parse the language file again
+            Logging::warn("Unable to save language cache '{}': {}", cachePath, e.what());
+        }
+    }
+
     static bool loadLanguageStringTable(fs::path languageFile)
     {
+        if (tryLoadLanguageCache(languageFile))
+        {
+            return true;
+        }
+
         try
         {
             YAML::Node node = YAML::LoadFile(languageFile.string());
             node = node["strings"];
 
+            std::vector<ProcessedString> table;
             for (YAML::const_iterator it = node.begin(); it != node.end(); ++it)
             {
                 int id = it->first.as<int>();
@@ -259,15 +412,14 @@ namespace OpenLoco::Localisation
                     continue;
 
                 std::string new_string = it->second.as<std::string>();
-                _stringsOwner.emplace_back(readString(new_string.data(), new_string.length()));
-                char* processedString = _stringsOwner.back().get();
-
-                if (processedString != nullptr)
-                {
-                    _strings[id] = processedString;
-                }
+                auto [processedString, length] = readString(new_string.data(), new_string.length());
+                _stringsOwner.emplace_back(std::move(processedString));
+                _strings[id] = _stringsOwner.back().get();
+                table.push_back(ProcessedString{ static_cast<StringId>(id), _stringsOwner.back().get(), length });
             }
 
+            saveLanguageCache(languageFile, table);
+
             return true;
         }
         catch (const std::exception& e)
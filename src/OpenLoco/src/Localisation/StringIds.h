@@ -1937,6 +1937,8 @@ namespace OpenLoco::StringIds
     constexpr StringId shortcutSeeThroughTracks = 2321;
     constexpr StringId shortcutSeeThroughTrees = 2322;
     constexpr StringId mountainModeTooltip = 2323;
+    constexpr StringId shortcutToggleProfilerOverlay = 2324;
+    constexpr StringId shortcutRecordProfilerTrace = 2325;
 
     constexpr StringId temporary_object_load_str_0 = 8192;
     constexpr StringId temporary_object_load_str_1 = 8193;
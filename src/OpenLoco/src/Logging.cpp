@@ -1,6 +1,7 @@
 #include "Logging.h"
 
 #include <OpenLoco/Diagnostics/LogFile.h>
+#include <OpenLoco/Diagnostics/LogQueue.h>
 #include <OpenLoco/Diagnostics/LogTerminal.h>
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Platform/Platform.h>
@@ -9,8 +10,9 @@
 
 namespace OpenLoco::Diagnostics::Logging
 {
-    static std::shared_ptr<LogTerminal> _terminalLogSink{};
-    static std::shared_ptr<LogFile> _fileLogSink{};
+    // Both are written to from their own thread so logging never stalls the game
+    static std::shared_ptr<LogQueue> _terminalLogSink{};
+    static std::shared_ptr<LogQueue> _fileLogSink{};
 
     // The maximum amount of log files to keep in the folder, will delete the oldest
     // logs if the amount of file exceeds this number.
@@ -101,15 +103,17 @@ namespace OpenLoco::Diagnostics::Logging
         const auto logLevelMask = parseLogLevels(logLevels);
 
         // Setup sink for the terminal/console.
-        _terminalLogSink = std::make_shared<LogTerminal>();
-        _terminalLogSink->setWriteTimestamps(false);
+        auto terminalLogSink = std::make_shared<LogTerminal>();
+        terminalLogSink->setWriteTimestamps(false);
+        _terminalLogSink = std::make_shared<LogQueue>(terminalLogSink);
         _terminalLogSink->setLevelMask(logLevelMask);
         Logging::installSink(_terminalLogSink);
 
         // Setup log file sink.
         const auto logFile = logsFolder / getLogFileName();
-        _fileLogSink = std::make_shared<LogFile>(logFile);
-        _fileLogSink->setWriteTimestamps(true);
+        auto fileLogSink = std::make_shared<LogFile>(logFile);
+        fileLogSink->setWriteTimestamps(true);
+        _fileLogSink = std::make_shared<LogQueue>(fileLogSink);
         _fileLogSink->setLevelMask(logLevelMask);
         Logging::installSink(_fileLogSink);
     }
@@ -118,5 +122,9 @@ namespace OpenLoco::Diagnostics::Logging
     {
         Logging::removeSink(_fileLogSink);
         Logging::removeSink(_terminalLogSink);
+
+        // Prints whatever is still queued
+        _fileLogSink.reset();
+        _terminalLogSink.reset();
     }
 }
@@ -5,6 +5,7 @@
 #include "GameState.h"
 #include "GameStateFlags.h"
 #include "IndustryElement.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <array>
 
@@ -83,6 +84,8 @@ namespace OpenLoco::World::AnimationManager
     // 0x004612EC
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("AnimationManager::update");
+
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded))
         {
             std::array<bool, Limits::kMaxAnimations> animsToRemove{};
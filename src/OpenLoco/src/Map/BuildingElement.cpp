@@ -111,6 +111,8 @@ namespace OpenLoco::World
                     }
 
                     TownManager::updateTownInfo(loc, buildingObj->producedQuantity[0], 0, 0, 0);
+                    // Normally already registered by the command that created it
+                    TownManager::registerBuilding(loc);
 
                     newUnk5u = 0;
                     newAge = 0;
@@ -19,14 +19,18 @@
 #include "Random.h"
 #include "S5/S5.h"
 #include "Scenario.h"
+#include "SceneManager.h"
 #include "Ui/ProgressBar.h"
 #include "Ui/WindowManager.h"
+#include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <cassert>
 #include <cstdint>
+#include <cstring>
 #include <random>
 #include <vector>
 
+using namespace OpenLoco::Diagnostics;
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::World;
 using namespace OpenLoco::Ui;
@@ -293,18 +297,30 @@ namespace OpenLoco::World::MapGenerator
         }
     }
 
-    // 0x004BDA49
-    static void generateTrees()
+    // Plants trees through the game command one at a time as vanilla does, the reference for TreePlanter
+    struct CommandTreePlanter
     {
-        const auto& options = S5::getOptions();
+        bool placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType)
+        {
+            return World::placeRandomTree(pos, treeType);
+        }
+
+        bool placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType)
+        {
+            return World::placeTreeCluster(centreLoc, range, density, treeType);
+        }
+    };
 
+    template<typename TPlanter>
+    static void plantTrees(TPlanter& planter, const S5::Options& options)
+    {
         // Place forests
         for (auto i = 0; i < options.numberOfForests; ++i)
         {
             const auto randRadius = ((gPrng1().randNext(255) * std::max(options.maxForestRadius - options.minForestRadius, 0)) / 255 + options.minForestRadius) * kTileSize;
             const auto randLoc = World::TilePos2(gPrng1().randNext(kMapRows), gPrng1().randNext(kMapColumns));
             const auto randDensity = (gPrng1().randNext(15) * std::max(options.maxForestDensity - options.minForestDensity, 0)) / 15 + options.minForestDensity;
-            placeTreeCluster(randLoc, randRadius, randDensity, std::nullopt);
+            planter.placeTreeCluster(randLoc, randRadius, randDensity, std::nullopt);
 
             if (TileManager::numFreeElements() < 0x36000)
             {
@@ -316,8 +332,19 @@ namespace OpenLoco::World::MapGenerator
         for (auto i = 0; i < options.numberRandomTrees; ++i)
         {
             const auto randLoc = World::Pos2(gPrng1().randNext(kMapWidth), gPrng1().randNext(kMapHeight));
-            placeRandomTree(randLoc, std::nullopt);
+            planter.placeRandomTree(randLoc, std::nullopt);
         }
+    }
+
+    // 0x004BDA49
+    static void generateTrees()
+    {
+        const auto& options = S5::getOptions();
+
+        // Every tree placed looks at the water around it, which planting trees does not change
+        TileManager::NeighbourhoodScope neighbourhood(TileManager::NeighbourhoodKind::water);
+        TreePlanter planter;
+        plantTrees(planter, options);
 
         // Cull trees that are too high / low
         uint32_t randMask = gPrng1().randNext();
@@ -529,4 +556,50 @@ namespace OpenLoco::World::MapGenerator
         Scenario::sub_4748D4();
         Ui::ProgressBar::end();
     }
+
+    bool verifyTreePlanter(const Core::Prng& rng)
+    {
+        const auto& options = S5::getOptions();
+        auto before = std::vector<TileElement>(TileManager::getElements().begin(), TileManager::getElements().end());
+
+        // TreePlanter only builds trees directly in the editor, anywhere else it uses the game command too
+        const auto wasEditor = isEditorMode();
+        setScreenFlag(ScreenFlags::editor);
+
+        gPrng1() = rng;
+        CommandTreePlanter commandPlanter;
+        plantTrees(commandPlanter, options);
+        const auto expected = std::vector<TileElement>(TileManager::getElements().begin(), TileManager::getElements().end());
+        const auto expectedRng = gPrng1();
+        TileManager::setElements(before);
+
+        gPrng1() = rng;
+        {
+            TileManager::NeighbourhoodScope neighbourhood(TileManager::NeighbourhoodKind::water);
+            TreePlanter planter;
+            plantTrees(planter, options);
+        }
+        const auto planted = TileManager::getElements();
+        const auto plantedRng = gPrng1();
+
+        bool matches = true;
+        if (planted.size() != expected.size() || std::memcmp(planted.data(), expected.data(), planted.size_bytes()) != 0)
+        {
+            Logging::error("Tile elements planted by TreePlanter ({}) differ from placing trees one at a time ({})", planted.size(), expected.size());
+            matches = false;
+        }
+        if (plantedRng.srand_0() != expectedRng.srand_0() || plantedRng.srand_1() != expectedRng.srand_1())
+        {
+            Logging::error("Tree planter drew a different number of random numbers");
+            matches = false;
+        }
+
+        TileManager::setElements(before);
+        gPrng1() = rng;
+        if (!wasEditor)
+        {
+            clearScreenFlag(ScreenFlags::editor);
+        }
+        return matches;
+    }
 }
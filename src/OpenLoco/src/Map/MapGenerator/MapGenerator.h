@@ -1,6 +1,7 @@
 #pragma once
 
 #include <OpenLoco/Core/EnumFlags.hpp>
+#include <OpenLoco/Core/Prng.h>
 #include <array>
 #include <cstdint>
 #include <optional>
@@ -41,4 +42,9 @@ namespace OpenLoco::World::MapGenerator
 
     void generate(const S5::Options& options);
     std::optional<uint8_t> getRandomTerrainVariation(const SurfaceElement& surface);
+
+    // Plants the forests and random trees of the landscape options from rng both one game command at
+    // a time and with a TreePlanter, returns false if the tile elements or random state differ. The
+    // map is left as it was.
+    bool verifyTreePlanter(const Core::Prng& rng);
 }
@@ -1,6 +1,9 @@
 #include "ModernTerrainGenerator.h"
 #include "S5/S5.h"
 #include <algorithm>
+#include <future>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::S5;
 
@@ -71,7 +74,28 @@ namespace OpenLoco::World::MapGenerator
         auto freq = settings.baseFreq * (1.0f / std::max(heightMap.width, heightMap.height));
         uint8_t perm[512];
         noise(perm, std::size(perm));
-        for (int32_t y = 0; y < heightMap.height; y++)
+
+        // Each tile only depends on its position and perm so the rows are split into bands that
+        // are generated in parallel, giving the same result as generating them in order.
+        const auto numBands = std::clamp<int32_t>(std::thread::hardware_concurrency(), 1, std::max(heightMap.height, 1));
+        const auto rowsPerBand = (heightMap.height + numBands - 1) / numBands;
+        std::vector<std::future<void>> bands;
+        for (int32_t top = 0; top < heightMap.height; top += rowsPerBand)
+        {
+            const auto bottom = std::min(top + rowsPerBand, heightMap.height);
+            bands.push_back(std::async(std::launch::async, [&settings, freq, &perm, heightMap, top, bottom]() mutable {
+                generateSimplexRows(settings, freq, perm, heightMap, top, bottom);
+            }));
+        }
+        for (auto& band : bands)
+        {
+            band.get();
+        }
+    }
+
+    void ModernTerrainGenerator::generateSimplexRows(const SimplexSettings& settings, float freq, uint8_t* perm, HeightMapRange heightMap, int32_t top, int32_t bottom)
+    {
+        for (int32_t y = top; y < bottom; y++)
         {
             for (int32_t x = 0; x < heightMap.width; x++)
             {
@@ -83,6 +107,9 @@ namespace OpenLoco::World::MapGenerator
         }
     }
 
+    // Note: copyHeight only copies the range so this smooths in place with each tile reading its
+    // already smoothed neighbours above and to the left. That makes rows depend on each other so
+    // unlike the noise this can not be split into bands without changing the result.
     void ModernTerrainGenerator::smooth(int32_t iterations, HeightMapRange heightMap)
     {
         for (int32_t i = 0; i < iterations; i++)
@@ -34,6 +34,8 @@ namespace OpenLoco::World::MapGenerator
 
         void generateSimplex(const SimplexSettings& settings, HeightMapRange heightMap);
 
+        static void generateSimplexRows(const SimplexSettings& settings, float freq, uint8_t* perm, HeightMapRange heightMap, int32_t top, int32_t bottom);
+
         static void smooth(int32_t iterations, HeightMapRange heightMap);
 
         static float noiseFractal(uint8_t* perm, int32_t x, int32_t y, float frequency, int32_t octaves, float lacunarity, float persistence);
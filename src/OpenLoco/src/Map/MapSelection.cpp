@@ -1,6 +1,7 @@
 #include "MapSelection.h"
 #include "Input.h"
 #include "Map/TileManager.h"
+#include "Paint/Paint.h"
 #include "Ui/ViewportInteraction.h"
 #include <OpenLoco/Interop/Interop.hpp>
 #include <utility>
@@ -161,6 +162,9 @@ namespace OpenLoco::World
         if (!World::hasMapSelectionFlag(World::MapSelectionFlags::enableConstruct))
             return;
 
+        // The selected tiles are not part of the static layer cache key
+        Paint::invalidateStaticLayerCache();
+
         for (uint16_t index = 0; index < kMapSelectedTilesSize; ++index)
         {
             auto& position = _mapSelectedTiles[index];
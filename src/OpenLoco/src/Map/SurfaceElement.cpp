@@ -1,6 +1,7 @@
 #include "SurfaceElement.h"
 #include "TileManager.h"
 #include "ViewportManager.h"
+#include "World/IndustrySurfaces.h"
 #include "World/TownManager.h"
 
 namespace OpenLoco::World
@@ -9,6 +10,7 @@ namespace OpenLoco::World
     {
         if (isIndustrial())
         {
+            IndustrySurfaces::remove(industryId(), World::toTileSpace(pos));
             setIsIndustrialFlag(false);
             setVar6SLR5(0);
             setIndustry(IndustryId(0));
@@ -21,6 +21,7 @@
 #include "Objects/TreeObject.h"
 #include "Objects/WaterObject.h"
 #include "OpenLoco.h"
+#include "Paint/Paint.h"
 #include "Random.h"
 #include "RoadElement.h"
 #include "SceneManager.h"
@@ -32,14 +33,21 @@
 #include "TreeElement.h"
 #include "Ui.h"
 #include "Ui/ViewportInteraction.h"
+#include "Vehicles/TrackPathfinding.h"
+#include "Vehicles/Vehicle.h"
 #include "ViewportManager.h"
 #include "WallElement.h"
 #include "World/CompanyManager.h"
 #include "World/IndustryManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <OpenLoco/Math/SummedAreaTable.hpp>
+#include <OpenLoco/Math/WindowedExtreme.hpp>
+#include <functional>
+#include <optional>
 #include <set>
 
 using namespace OpenLoco::Interop;
@@ -95,6 +103,7 @@ namespace OpenLoco::World::TileManager
             *element = *reinterpret_cast<TileElement*>(&defaultElement);
         }
         updateTilePointers();
+        TownManager::invalidateBuildingRegistry();
         getGameState().flags |= GameStateFlags::tileManagerLoaded;
     }
 
@@ -119,6 +128,7 @@ namespace OpenLoco::World::TileManager
         std::memset(dst, 0, maxElements * sizeof(TileElement));
         std::memcpy(dst, elements.data(), elements.size_bytes());
         TileManager::updateTilePointers();
+        TownManager::invalidateBuildingRegistry();
     }
 
     // Note: Must be past the last tile flag
@@ -509,6 +519,9 @@ namespace OpenLoco::World::TileManager
         }
 
         _elementsEnd = el;
+        Paint::invalidateStaticLayerCache();
+        Vehicles::invalidateAllSignalBlocks();
+        Vehicles::TrackPathfinding::invalidateAll();
     }
 
     // 0x0046148F
@@ -637,30 +650,149 @@ namespace OpenLoco::World::TileManager
         }
     }
 
+    // Radius of the square around a tile looked at by the neighbourhood queries
+    static constexpr coord_t kNeighbourhoodRadius = 5;
+
+    struct NeighbourhoodTables
+    {
+        NeighbourhoodKind kinds;
+        std::optional<Math::SummedAreaTable<uint32_t>> water;
+        std::optional<Math::SummedAreaTable<uint32_t>> desert;
+        std::optional<Math::SummedAreaTable<uint32_t>> trees;
+        std::optional<Math::WindowedExtreme<int16_t>> lowest;
+        std::optional<Math::WindowedExtreme<int16_t, std::greater<int16_t>>> highest;
+    };
+
+    static std::unique_ptr<NeighbourhoodTables> _neighbourhoodTables;
+
+    NeighbourhoodScope::NeighbourhoodScope(NeighbourhoodKind kinds)
+        : _previous(std::move(_neighbourhoodTables))
+    {
+        _neighbourhoodTables = std::make_unique<NeighbourhoodTables>();
+        _neighbourhoodTables->kinds = kinds;
+    }
+
+    NeighbourhoodScope::~NeighbourhoodScope()
+    {
+        _neighbourhoodTables = std::move(_previous);
+    }
+
+    void NeighbourhoodScope::invalidate()
+    {
+        _neighbourhoodTables->water = std::nullopt;
+        _neighbourhoodTables->desert = std::nullopt;
+        _neighbourhoodTables->trees = std::nullopt;
+        _neighbourhoodTables->lowest = std::nullopt;
+        _neighbourhoodTables->highest = std::nullopt;
+    }
+
+    static NeighbourhoodTables* getNeighbourhoodTables(NeighbourhoodKind kind)
+    {
+        if (_neighbourhoodTables == nullptr || (_neighbourhoodTables->kinds & kind) == NeighbourhoodKind::none)
+        {
+            return nullptr;
+        }
+        return _neighbourhoodTables.get();
+    }
+
+    template<typename TGetValue>
+    static Math::SummedAreaTable<uint32_t> buildNeighbourhoodSums(TGetValue&& getValue)
+    {
+        return Math::SummedAreaTable<uint32_t>(kMapColumns, kMapRows, [&getValue](int32_t x, int32_t y) {
+            return static_cast<uint32_t>(getValue(TilePos2(x, y)));
+        });
+    }
+
+    static uint32_t sumNeighbourhood(const Math::SummedAreaTable<uint32_t>& sums, const TilePos2& pos)
+    {
+        return sums.sum(pos.x - kNeighbourhoodRadius, pos.y - kNeighbourhoodRadius, pos.x + kNeighbourhoodRadius, pos.y + kNeighbourhoodRadius);
+    }
+
+    static int16_t getLowestSurfaceHeight(const TilePos2& pos)
+    {
+        return get(pos).surface()->baseHeight();
+    }
+
+    static int16_t getHighestSurfaceHeight(const TilePos2& pos)
+    {
+        auto* surface = get(pos).surface();
+        auto height = surface->baseHeight();
+        if (surface->slope())
+        {
+            height += 16;
+            if (surface->isSlopeDoubleHeight())
+            {
+                height += 16;
+            }
+        }
+        return height;
+    }
+
+    static bool hasWater(const TilePos2& pos)
+    {
+        auto* surface = get(pos).surface();
+        return surface != nullptr && surface->water() > 0;
+    }
+
+    static bool isDesert(const TilePos2& pos)
+    {
+        auto* surface = get(pos).surface();
+        // Desert tiles can't have water! Oasis aren't deserts.
+        if (surface == nullptr || surface->water() != 0)
+        {
+            return false;
+        }
+        auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
+        return landObj != nullptr && landObj->hasFlags(LandObjectFlags::isDesert);
+    }
+
+    static uint16_t countTrees(const TilePos2& pos)
+    {
+        uint16_t numTrees = 0;
+        auto tile = get(pos);
+        for (auto& element : tile)
+        {
+            // NB: vanilla was checking for trees above the surface element.
+            // This has been omitted from our implementation.
+            auto* tree = element.as<TreeElement>();
+            if (tree == nullptr)
+                continue;
+
+            if (tree->isGhost())
+                continue;
+
+            numTrees++;
+        }
+        return numTrees;
+    }
+
     // 0x00469A81
     int16_t mountainHeight(const World::Pos2& loc)
     {
         // Works out roughly the height of a mountain of area 11 * 11
         // (Its just the heighest point - the lowest point)
+        const auto initialTilePos = toTileSpace(loc);
+        // Off the map the clamped area is no longer centred on the position
+        auto* tables = validCoords(initialTilePos) ? getNeighbourhoodTables(NeighbourhoodKind::height) : nullptr;
+        if (tables != nullptr)
+        {
+            if (!tables->lowest.has_value())
+            {
+                const auto getLowest = [](int32_t x, int32_t y) { return getLowestSurfaceHeight(TilePos2(x, y)); };
+                const auto getHighest = [](int32_t x, int32_t y) { return getHighestSurfaceHeight(TilePos2(x, y)); };
+                tables->lowest.emplace(kMapColumns, kMapRows, kNeighbourhoodRadius, getLowest);
+                tables->highest.emplace(kMapColumns, kMapRows, kNeighbourhoodRadius, getHighest);
+            }
+            return std::max<int16_t>(tables->highest->get(initialTilePos.x, initialTilePos.y), 0) - tables->lowest->get(initialTilePos.x, initialTilePos.y);
+        }
+
         int16_t lowest = std::numeric_limits<int16_t>::max();
         int16_t highest = 0;
-        const auto initialTilePos = toTileSpace(loc);
         auto range = getClampedRange(initialTilePos - TilePos2{ 5, 5 }, initialTilePos + TilePos2{ 5, 5 });
         for (auto& tilePos : range)
         {
-            auto tile = World::TileManager::get(tilePos);
-            auto* surface = tile.surface();
-            auto height = surface->baseHeight();
-            lowest = std::min(lowest, height);
-            if (surface->slope())
-            {
-                height += 16;
-                if (surface->isSlopeDoubleHeight())
-                {
-                    height += 16;
-                }
-            }
-            highest = std::max(highest, height);
+            lowest = std::min(lowest, getLowestSurfaceHeight(tilePos));
+            highest = std::max(highest, getHighestSurfaceHeight(tilePos));
         }
         return highest - lowest;
     }
@@ -668,6 +800,15 @@ namespace OpenLoco::World::TileManager
     // 0x004C5596
     uint16_t countSurroundingWaterTiles(const Pos2& pos)
     {
+        if (auto* tables = getNeighbourhoodTables(NeighbourhoodKind::water))
+        {
+            if (!tables->water.has_value())
+            {
+                tables->water = buildNeighbourhoodSums(hasWater);
+            }
+            return sumNeighbourhood(*tables->water, World::toTileSpace(pos));
+        }
+
         // Search a 10x10 area centred at pos.
         // Initial tile position is the top left of the area.
         auto initialTilePos = World::toTileSpace(pos) - World::TilePos2(5, 5);
@@ -681,9 +822,7 @@ namespace OpenLoco::World::TileManager
                 if (!World::validCoords(tilePos))
                     continue;
 
-                auto tile = get(tilePos);
-                auto* surface = tile.surface();
-                if (surface != nullptr && surface->water() > 0)
+                if (hasWater(tilePos))
                     surroundingWaterTiles++;
             }
         }
@@ -694,6 +833,17 @@ namespace OpenLoco::World::TileManager
     // 0x00469B1D
     uint16_t countSurroundingDesertTiles(const Pos2& pos)
     {
+        // Off the map the clamped area is no longer centred on the position
+        auto* tables = validCoords(toTileSpace(pos)) ? getNeighbourhoodTables(NeighbourhoodKind::desert) : nullptr;
+        if (tables != nullptr)
+        {
+            if (!tables->desert.has_value())
+            {
+                tables->desert = buildNeighbourhoodSums(isDesert);
+            }
+            return sumNeighbourhood(*tables->desert, toTileSpace(pos));
+        }
+
         // Search a 10x10 area centred at pos.
         // Initial tile position is the top left of the area.
         auto initialTilePos = toTileSpace(pos) - TilePos2(5, 5);
@@ -702,19 +852,7 @@ namespace OpenLoco::World::TileManager
 
         for (const auto& tilePos : getClampedRange(initialTilePos, initialTilePos + TilePos2{ 10, 10 }))
         {
-            auto tile = get(tilePos);
-            auto* surface = tile.surface();
-            // Desert tiles can't have water! Oasis aren't deserts.
-            if (surface == nullptr || surface->water() != 0)
-            {
-                continue;
-            }
-            auto* landObj = ObjectManager::get<LandObject>(surface->terrain());
-            if (landObj == nullptr)
-            {
-                continue;
-            }
-            if (landObj->hasFlags(LandObjectFlags::isDesert))
+            if (isDesert(tilePos))
             {
                 surroundingDesertTiles++;
             }
@@ -726,6 +864,15 @@ namespace OpenLoco::World::TileManager
     // 0x004BE048
     uint16_t countSurroundingTrees(const Pos2& pos)
     {
+        if (auto* tables = getNeighbourhoodTables(NeighbourhoodKind::trees))
+        {
+            if (!tables->trees.has_value())
+            {
+                tables->trees = buildNeighbourhoodSums(countTrees);
+            }
+            return sumNeighbourhood(*tables->trees, World::toTileSpace(pos));
+        }
+
         // Search a 10x10 area centred at pos.
         // Initial tile position is the top left of the area.
         auto initialTilePos = World::toTileSpace(pos) - World::TilePos2(5, 5);
@@ -739,20 +886,7 @@ namespace OpenLoco::World::TileManager
                 if (!World::validCoords(tilePos))
                     continue;
 
-                auto tile = get(tilePos);
-                for (auto& element : tile)
-                {
-                    // NB: vanilla was checking for trees above the surface element.
-                    // This has been omitted from our implementation.
-                    auto* tree = element.as<TreeElement>();
-                    if (tree == nullptr)
-                        continue;
-
-                    if (tree->isGhost())
-                        continue;
-
-                    surroundingTrees++;
-                }
+                surroundingTrees += countTrees(tilePos);
             }
         }
 
@@ -811,6 +945,8 @@ namespace OpenLoco::World::TileManager
     // 0x00463ABA
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("TileManager::update");
+
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
         {
             return;
@@ -3,6 +3,7 @@
 #include "Tile.h"
 #include <OpenLoco/Core/EnumFlags.hpp>
 #include <cstdint>
+#include <memory>
 #include <set>
 #include <span>
 
@@ -32,6 +33,36 @@ namespace OpenLoco::World::TileManager
     };
     OPENLOCO_ENABLE_ENUM_OPERATORS(ElementPositionFlags);
 
+    enum class NeighbourhoodKind : uint8_t
+    {
+        none = 0U,
+        water = 1U << 0,
+        desert = 1U << 1,
+        trees = 1U << 2,
+        height = 1U << 3,
+        all = water | desert | trees | height,
+    };
+    OPENLOCO_ENABLE_ENUM_OPERATORS(NeighbourhoodKind);
+
+    struct NeighbourhoodTables;
+
+    // While alive, mountainHeight and the countSurrounding functions of the given kinds are answered
+    // from tables of the whole map, each built the first time it is needed. Only for a batch of
+    // queries during which nothing they look at changes on the map, or invalidate has to be called.
+    class NeighbourhoodScope
+    {
+    private:
+        std::unique_ptr<NeighbourhoodTables> _previous;
+
+    public:
+        explicit NeighbourhoodScope(NeighbourhoodKind kinds);
+        ~NeighbourhoodScope();
+        NeighbourhoodScope(const NeighbourhoodScope&) = delete;
+        NeighbourhoodScope& operator=(const NeighbourhoodScope&) = delete;
+
+        void invalidate();
+    };
+
     void allocateMapElements();
     void initialise();
     std::span<TileElement> getElements();
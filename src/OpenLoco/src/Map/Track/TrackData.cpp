@@ -446,4 +446,57 @@ namespace OpenLoco::World::TrackData
     {
         return kTrackCostFactor[trackId];
     }
+
+    // 0x004F89CC
+    constexpr std::array<uint32_t, 44> kTrackLength = {
+        32,
+        45,
+        25,
+        25,
+        75,
+        75,
+        126,
+        126,
+        88,
+        88,
+        88,
+        88,
+        106,
+        106,
+        66,
+        66,
+        36,
+        36,
+        77,
+        77,
+        77,
+        77,
+        82,
+        82,
+        82,
+        82,
+        32,
+        32,
+        13,
+        38,
+        38,
+        13,
+        36,
+        36,
+        36,
+        36,
+        36,
+        36,
+        34,
+        34,
+        34,
+        34,
+        26,
+        26,
+    };
+
+    uint32_t getTrackLength(size_t trackId)
+    {
+        return kTrackLength[trackId];
+    }
 }
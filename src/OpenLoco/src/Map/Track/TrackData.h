@@ -62,4 +62,7 @@ namespace OpenLoco::World::TrackData
     // TODO: Combine these two
     uint16_t getTrackCompatibleFlags(size_t trackId);
     uint16_t getTrackCostFactor(size_t trackId);
+
+    // Rough length of the piece, as used by the route choice at junctions
+    uint32_t getTrackLength(size_t trackId);
 }
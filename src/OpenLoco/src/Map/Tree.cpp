@@ -8,25 +8,27 @@
 #include "Objects/TreeObject.h"
 #include "Random.h"
 #include "Scenario.h"
+#include "SceneManager.h"
 #include "SurfaceElement.h"
 #include "TileManager.h"
 #include "Ui/ViewportInteraction.h"
 #include <OpenLoco/Math/Trigonometry.hpp>
+#include <algorithm>
 
 namespace OpenLoco::World
 {
-    // 0x004BDF19
-    std::optional<uint8_t> getRandomTreeTypeFromSurface(const World::TilePos2& loc, bool unk)
+    // What a tree needs to have, or must not have, to grow on a surface. Nullopt if nothing grows there.
+    static std::optional<TreeSurfaceConditions> getTreeSurfaceConditions(const World::TilePos2& loc, bool unk)
     {
         if (!World::validCoords(loc))
         {
-            return {};
+            return std::nullopt;
         }
 
         auto* surface = World::TileManager::get(loc).surface();
         if (surface == nullptr)
         {
-            return {};
+            return std::nullopt;
         }
 
         TreeObjectFlags mustNotTreeFlags = TreeObjectFlags::none;
@@ -59,7 +61,7 @@ namespace OpenLoco::World
 
         if (landObj->hasFlags(LandObjectFlags::noTrees))
         {
-            return {};
+            return std::nullopt;
         }
         mustNotTreeFlags |= TreeObjectFlags::requiresWater;
         const uint16_t numSameTypeSurfaces = TileManager::countSurroundingWaterTiles(World::toWorldSpace(loc));
@@ -68,6 +70,11 @@ namespace OpenLoco::World
             mustNotTreeFlags &= ~TreeObjectFlags::requiresWater;
         }
 
+        return TreeSurfaceConditions{ mustTreeFlags, mustNotTreeFlags };
+    }
+
+    static std::vector<uint8_t> getSelectableTrees(const TreeSurfaceConditions& conditions)
+    {
         std::vector<uint8_t> selectableTrees;
         for (uint8_t i = 0; i < ObjectManager::getMaxObjects(ObjectType::tree); ++i)
         {
@@ -76,18 +83,22 @@ namespace OpenLoco::World
             {
                 continue;
             }
-            if (treeObj->hasFlags(mustNotTreeFlags))
+            if (treeObj->hasFlags(conditions.mustNotTreeFlags))
             {
                 continue;
             }
 
-            if ((treeObj->flags & mustTreeFlags) != mustTreeFlags)
+            if ((treeObj->flags & conditions.mustTreeFlags) != conditions.mustTreeFlags)
             {
                 continue;
             }
             selectableTrees.push_back(i);
         }
+        return selectableTrees;
+    }
 
+    static std::optional<uint8_t> pickRandomTree(const std::vector<uint8_t>& selectableTrees)
+    {
         if (selectableTrees.empty())
         {
             return {};
@@ -97,7 +108,21 @@ namespace OpenLoco::World
         return { selectableTrees[rng.randNext(selectableTrees.size() - 1)] };
     }
 
-    bool placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType)
+    // 0x004BDF19
+    std::optional<uint8_t> getRandomTreeTypeFromSurface(const World::TilePos2& loc, bool unk)
+    {
+        const auto conditions = getTreeSurfaceConditions(loc, unk);
+        if (!conditions.has_value())
+        {
+            return {};
+        }
+        return pickRandomTree(getSelectableTrees(*conditions));
+    }
+
+    // Everything placeRandomTree does up to the point the tree is built. Returns nullopt if there is
+    // no tree type that suits the surface.
+    template<typename TGetRandomTreeType>
+    static std::optional<GameCommands::TreePlacementArgs> getRandomTreePlacementArgs(const World::Pos2& pos, std::optional<uint8_t> treeType, TGetRandomTreeType&& getRandomTreeType)
     {
         GameCommands::TreePlacementArgs args;
         args.quadrant = World::getQuadrantFromPos(pos);
@@ -110,31 +135,21 @@ namespace OpenLoco::World
         std::optional<uint8_t> randTreeType = treeType;
         if (!randTreeType.has_value())
         {
-            randTreeType = getRandomTreeTypeFromSurface(World::toTileSpace(args.pos), false);
+            randTreeType = getRandomTreeType(World::toTileSpace(args.pos));
             // It is possible that there are no valid tree types for the surface
             if (!randTreeType.has_value())
             {
-                return false;
+                return std::nullopt;
             }
         }
         args.type = *randTreeType;
         args.buildImmediately = true;
         args.requiresFullClearance = true;
-
-        // First query if we can place a tree at this location; skip if we can't.
-        auto queryRes = doCommand(args, 0);
-        if (queryRes == GameCommands::FAILURE)
-        {
-            return false;
-        }
-
-        // Actually place the tree
-        doCommand(args, GameCommands::Flags::apply);
-        return true;
+        return args;
     }
 
-    // 0x004BDC67 (when treeType is nullopt) & 0x004BDDC6 (when treeType is set)
-    bool placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType)
+    template<typename TPlaceRandomTree>
+    static bool placeTreeClusterWith(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, TPlaceRandomTree&& placeRandomTree)
     {
         const auto numPlacements = (range * range * density) / 8192;
         uint16_t numErrors = 0;
@@ -148,7 +163,7 @@ namespace OpenLoco::World
                 Math::Trigonometry::integerSinePrecisionHigh(randomDirection, randomMagnitude),
                 Math::Trigonometry::integerCosinePrecisionHigh(randomDirection, randomMagnitude));
 
-            if (!placeRandomTree(randomOffset + World::toWorldSpace(centreLoc), treeType))
+            if (!placeRandomTree(randomOffset + World::toWorldSpace(centreLoc)))
             {
                 numErrors++;
             }
@@ -157,4 +172,84 @@ namespace OpenLoco::World
         // Have we placed any trees?
         return (numErrors < numPlacements);
     }
+
+    bool placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType)
+    {
+        const auto args = getRandomTreePlacementArgs(pos, treeType, [](const World::TilePos2& loc) {
+            return getRandomTreeTypeFromSurface(loc, false);
+        });
+        if (!args.has_value())
+        {
+            return false;
+        }
+
+        // First query if we can place a tree at this location; skip if we can't.
+        auto queryRes = doCommand(*args, 0);
+        if (queryRes == GameCommands::FAILURE)
+        {
+            return false;
+        }
+
+        // Actually place the tree
+        doCommand(*args, GameCommands::Flags::apply);
+        return true;
+    }
+
+    // 0x004BDC67 (when treeType is nullopt) & 0x004BDDC6 (when treeType is set)
+    bool placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType)
+    {
+        return placeTreeClusterWith(centreLoc, range, density, [treeType](const World::Pos2& pos) {
+            return placeRandomTree(pos, treeType);
+        });
+    }
+
+    std::optional<uint8_t> TreePlanter::getRandomTreeType(const World::TilePos2& loc)
+    {
+        const auto conditions = getTreeSurfaceConditions(loc, false);
+        if (!conditions.has_value())
+        {
+            return {};
+        }
+
+        auto it = std::find_if(_selectableTrees.begin(), _selectableTrees.end(), [&conditions](const auto& entry) {
+            return entry.first.mustTreeFlags == conditions->mustTreeFlags && entry.first.mustNotTreeFlags == conditions->mustNotTreeFlags;
+        });
+        if (it == _selectableTrees.end())
+        {
+            it = _selectableTrees.emplace(_selectableTrees.end(), *conditions, getSelectableTrees(*conditions));
+        }
+        return pickRandomTree(it->second);
+    }
+
+    bool TreePlanter::placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType)
+    {
+        const auto args = getRandomTreePlacementArgs(pos, treeType, [this](const World::TilePos2& loc) {
+            return getRandomTreeType(loc);
+        });
+        if (!args.has_value())
+        {
+            return false;
+        }
+
+        if (!isEditorMode())
+        {
+            // Outside the editor placing a tree is charged to the company, so keep going through the game command
+            if (doCommand(*args, 0) == GameCommands::FAILURE)
+            {
+                return false;
+            }
+            doCommand(*args, GameCommands::Flags::apply);
+            return true;
+        }
+
+        // The same checks as the query and apply of a game command, only done once
+        return GameCommands::createTree(*args, GameCommands::Flags::apply) != GameCommands::FAILURE;
+    }
+
+    bool TreePlanter::placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType)
+    {
+        return placeTreeClusterWith(centreLoc, range, density, [this, treeType](const World::Pos2& pos) {
+            return placeRandomTree(pos, treeType);
+        });
+    }
 }
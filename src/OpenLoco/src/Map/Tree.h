@@ -1,11 +1,36 @@
 #pragma once
 
+#include "Objects/TreeObject.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <optional>
+#include <utility>
+#include <vector>
 
 namespace OpenLoco::World
 {
+    struct TreeSurfaceConditions
+    {
+        TreeObjectFlags mustTreeFlags;
+        TreeObjectFlags mustNotTreeFlags;
+    };
+
     std::optional<uint8_t> getRandomTreeTypeFromSurface(const World::TilePos2& loc, bool unk);
     bool placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType);
     bool placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType);
+
+    // Plants trees for landscape generation exactly as placeRandomTree and placeTreeCluster would,
+    // drawing the same random numbers, but builds each tree directly instead of through a query and
+    // an apply of the game command. The tree types that suit each kind of surface are only worked
+    // out once, so the loaded tree objects must not change while it is in use.
+    class TreePlanter
+    {
+    private:
+        std::vector<std::pair<TreeSurfaceConditions, std::vector<uint8_t>>> _selectableTrees;
+
+        std::optional<uint8_t> getRandomTreeType(const World::TilePos2& loc);
+
+    public:
+        bool placeRandomTree(const World::Pos2& pos, std::optional<uint8_t> treeType);
+        bool placeTreeCluster(const World::TilePos2& centreLoc, const uint16_t range, const uint16_t density, const std::optional<uint8_t> treeType);
+    };
 }
@@ -12,6 +12,7 @@
 #include "Wave.h"
 #include <OpenLoco/Core/LocoFixedVector.hpp>
 #include <OpenLoco/Core/Prng.h>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 namespace OpenLoco::World::WaveManager
@@ -80,6 +81,8 @@ namespace OpenLoco::World::WaveManager
     // 0x004C56F6
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("WaveManager::update");
+
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded) || (ScenarioManager::getScenarioTicks() & 0x3))
         {
             return;
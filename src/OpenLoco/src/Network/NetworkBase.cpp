@@ -44,7 +44,8 @@ void NetworkBase::receivePacketLoop()
         }
         if (!receivedPacket)
         {
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            // Wakes up now and then to see if the loop should end
+            Socket::waitForData(_sockets, 20);
         }
     }
 }
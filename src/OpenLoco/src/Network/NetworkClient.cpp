@@ -4,6 +4,7 @@
 #include "Logging.h"
 #include "NetworkConnection.h"
 #include "S5/S5.h"
+#include "ScenarioManager.h"
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/BinaryStream.h>
@@ -95,6 +96,9 @@ void NetworkClient::onUpdate()
                     break;
                 case NetworkClientStatus::waitingForState:
                     break;
+                case NetworkClientStatus::connected:
+                    verifyStateChecksums();
+                    break;
                 default:
                     break;
             }
@@ -265,6 +269,8 @@ void NetworkClient::processFullState(std::span<uint8_t const> fullData)
     _localGameCommandIndex = extra->gameCommandIndex;
     _localTick = extra->tick;
     updateLocalTick();
+    _hasServerChecksums = false;
+    _desyncReported = false;
 
     BinaryStream bs(fullData.data(), fullData.size() - sizeof(ExtraState));
     S5::importSaveToGameState(bs, S5::LoadFlags::none);
@@ -289,6 +295,46 @@ void NetworkClient::receivePingPacket(const PingPacket& packet)
         // No pending game commands, we can update to this tick
         _localTick = packet.tick;
     }
+
+    // Keep the latest server checksums until we have simulated up to the same tick
+    _serverChecksumsTick = packet.tick;
+    _serverChecksums = packet.checksums;
+    _hasServerChecksums = true;
+}
+
+void NetworkClient::verifyStateChecksums()
+{
+    if (!_hasServerChecksums)
+        return;
+
+    const auto tick = ScenarioManager::getScenarioTicks();
+    if (tick < _serverChecksumsTick)
+        return;
+
+    _hasServerChecksums = false;
+
+    // We have already simulated past the tick so there is nothing to compare against
+    if (tick != _serverChecksumsTick)
+        return;
+
+    // Only the first divergent tick is useful, every tick after it will differ too
+    if (_desyncReported)
+        return;
+
+    const auto localChecksums = computeStateChecksums();
+    if (localChecksums == _serverChecksums)
+        return;
+
+    _desyncReported = true;
+    Logging::error("Desync detected at tick {}", tick);
+    for (size_t i = 0; i < localChecksums.values.size(); i++)
+    {
+        const auto kind = static_cast<StateChecksumKind>(i);
+        if (localChecksums.get(kind) != _serverChecksums.get(kind))
+        {
+            Logging::error("  {} differ (local {:08X}, server {:08X})", getStateChecksumName(kind), localChecksums.get(kind), _serverChecksums.get(kind));
+        }
+    }
 }
 
 void NetworkClient::receiveGameCommandPacket(const GameCommandPacket& packet)
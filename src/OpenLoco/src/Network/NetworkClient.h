@@ -3,6 +3,7 @@
 #include "Network.h"
 #include "NetworkBase.h"
 #include "Socket.h"
+#include "StateChecksum.h"
 #include <cstdint>
 #include <list>
 #include <span>
@@ -34,6 +35,10 @@ namespace OpenLoco::Network
         uint32_t _localTick;
         uint32_t _serverTick;
         std::list<GameCommandPacket> _receivedGameCommands;
+        uint32_t _serverChecksumsTick{};
+        StateChecksums _serverChecksums;
+        bool _hasServerChecksums{};
+        bool _desyncReported{};
 
         struct ReceivedChunk
         {
@@ -54,6 +59,7 @@ namespace OpenLoco::Network
         void onReceivePacketFromServer(const Packet& packet);
         void processFullState(std::span<uint8_t const> data);
         void updateLocalTick();
+        void verifyStateChecksums();
 
         void initStatus(std::string_view text);
         void setStatus(std::string_view text);
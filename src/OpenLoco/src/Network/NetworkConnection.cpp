@@ -1,11 +1,13 @@
 #include "NetworkConnection.h"
 #include "Logging.h"
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
 #include <cstring>
 
 using namespace OpenLoco::Network;
 
 constexpr uint32_t kRedeliverTimeout = 1000;
+constexpr uint32_t kMissingRedeliverTimeout = 100;
 constexpr uint32_t kConnectionTimeout = 15000;
 
 NetworkConnection::NetworkConnection(IUdpSocket* socket, std::unique_ptr<INetworkEndpoint> endpoint)
@@ -34,28 +36,65 @@ bool NetworkConnection::hasTimedOut() const
     return false;
 }
 
+// Whether a comes before b, allowing for the sequence wrapping around
+static bool isSequenceBefore(sequence_t a, sequence_t b)
+{
+    return static_cast<int16_t>(a - b) < 0;
+}
+
 void NetworkConnection::update()
 {
-    resendUndeliveredPackets();
+    transmitUndeliveredPackets();
+
+    // Only if nothing else has been sent since to carry the acknowledgement
+    bool hasUnacknowledgedPackets;
+    {
+        std::unique_lock<std::mutex> lk(_receiveWindowSync);
+        hasUnacknowledgedPackets = _numUnacknowledgedPackets != 0;
+    }
+    if (hasUnacknowledgedPackets)
+    {
+        sendAcknowledgePacket();
+    }
 }
 
-bool NetworkConnection::checkOrRecordReceivedSequence(sequence_t sequence)
+// Returns false if the packet has already been received or is too far ahead to be taken yet
+bool NetworkConnection::recordReceivedSequence(sequence_t sequence)
 {
-    for (auto s : _receivedSequences)
+    const auto offset = static_cast<sequence_t>(sequence - _receiveSequence);
+    if (offset >= kWindowSize)
     {
-        if (s == sequence)
-        {
-            return true;
-        }
+        return false;
     }
 
-    while (_receivedSequences.size() >= 1024)
+    const auto index = sequence % kWindowSize;
+    if (_receivedSequences[index])
     {
-        _receivedSequences.pop_back();
+        return false;
     }
+    _receivedSequences[index] = true;
 
-    _receivedSequences.push_back(sequence);
-    return false;
+    while (_receivedSequences[_receiveSequence % kWindowSize])
+    {
+        _receivedSequences[_receiveSequence % kWindowSize] = false;
+        _receiveSequence++;
+    }
+    return true;
+}
+
+void NetworkConnection::writeAcknowledgement(PacketHeader& header)
+{
+    std::unique_lock<std::mutex> lk(_receiveWindowSync);
+    header.ack = _receiveSequence;
+    header.ackBits = 0;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        if (_receivedSequences[(_receiveSequence + 1 + i) % kWindowSize])
+        {
+            header.ackBits |= 1U << i;
+        }
+    }
+    _numUnacknowledgedPackets = 0;
 }
 
 void NetworkConnection::receivePacket(const Packet& packet)
@@ -63,22 +102,32 @@ void NetworkConnection::receivePacket(const Packet& packet)
     _timeOfLastReceivedPacket = Platform::getTime();
 
     logPacket(packet, false, false);
+    receiveAcknowledgement(packet.header.ack, packet.header.ackBits);
     if (packet.header.kind == PacketKind::ack)
     {
-        receiveAcknowledgePacket(packet.header.sequence);
+        return;
     }
-    else
+
+    // Duplicates are acknowledged again as well, the acknowledgement sent before may have been lost
+    bool isNewPacket;
+    bool shouldAcknowledgeNow;
     {
-        // Send ACK back, even if we have already received this packet before
-        // the ACK we sent before, may not have been delivered successfully
-        sendAcknowledgePacket(packet.header.sequence);
+        std::unique_lock<std::mutex> lk(_receiveWindowSync);
+        isNewPacket = recordReceivedSequence(packet.header.sequence);
+        _numUnacknowledgedPackets++;
+        shouldAcknowledgeNow = _numUnacknowledgedPackets >= 32;
+    }
 
-        // Only store the packet, if this is the first time we received it
-        if (!checkOrRecordReceivedSequence(packet.header.sequence))
-        {
-            std::unique_lock<std::mutex> lk(_receivedPacketsSync);
-            _receivedPackets.push(packet);
-        }
+    if (isNewPacket)
+    {
+        std::unique_lock<std::mutex> lk(_receivedPacketsSync);
+        _receivedPackets.push(packet);
+    }
+
+    // Keeps a sender with many packets in flight, such as during a state transfer, from stalling
+    if (shouldAcknowledgeNow)
+    {
+        sendAcknowledgePacket();
     }
 }
 
@@ -86,66 +135,101 @@ void NetworkConnection::sendPacket(PacketKind kind, size_t dataSize, const void*
 {
     assert(dataSize <= kMaxPacketDataSize);
 
-    Packet packet;
+    std::unique_lock<std::mutex> lk(_sentPacketsSync);
+    auto& sentPacket = _sentPackets.emplace_back();
+    sentPacket.timestamp = getTime();
+    sentPacket.isTransmitted = false;
+    sentPacket.isAcknowledged = false;
+    sentPacket.isMissing = false;
+
+    auto& packet = sentPacket.packet;
     packet.header.kind = kind;
     packet.header.sequence = _sendSequence++;
     packet.header.dataSize = static_cast<uint16_t>(dataSize);
     std::memcpy(packet.data, packetData, packet.header.dataSize);
 
-    sendPacket(packet);
+    // Otherwise it waits in the queue until enough of the packets before it have been acknowledged
+    if (_sentPackets.size() <= kWindowSize)
+    {
+        transmitPacket(packet, false);
+        sentPacket.isTransmitted = true;
+    }
 }
 
-void NetworkConnection::sendPacket(const Packet& packet)
+void NetworkConnection::transmitPacket(Packet& packet, bool resend)
 {
-    if (packet.header.kind != PacketKind::ack)
-    {
-        std::unique_lock<std::mutex> lk(_sentPacketsSync);
-        auto timestamp = getTime();
-        _sentPackets.push_back({ timestamp, packet });
-    }
+    writeAcknowledgement(packet.header);
 
     size_t packetSize = sizeof(PacketHeader) + packet.header.dataSize;
     _socket->sendData(*_endpoint, &packet, packetSize);
-    logPacket(packet, true, false);
+    logPacket(packet, true, resend);
 }
 
-void NetworkConnection::receiveAcknowledgePacket(sequence_t sequence)
+void NetworkConnection::receiveAcknowledgement(sequence_t ack, uint32_t ackBits)
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    while (!_sentPackets.empty() && isSequenceBefore(_sentPackets.front().packet.header.sequence, ack))
+    {
+        _sentPackets.pop_front();
+    }
+    if (_sentPackets.empty())
     {
-        if (_sentPackets[i].packet.header.sequence == sequence)
+        return;
+    }
+
+    // Anything not acknowledged before the last packet that was is most likely lost, and resent
+    // sooner than the rest
+    const auto firstSequence = _sentPackets.front().packet.header.sequence;
+    size_t numMissing = 0;
+    for (uint32_t i = 0; i < 32; i++)
+    {
+        if (ackBits & (1U << i))
         {
-            _sentPackets.erase(_sentPackets.begin() + i);
-            break;
+            const auto index = static_cast<sequence_t>(ack + 1 + i - firstSequence);
+            if (index < _sentPackets.size())
+            {
+                _sentPackets[index].isAcknowledged = true;
+                numMissing = index;
+            }
         }
     }
+    for (size_t i = 0; i < numMissing; i++)
+    {
+        _sentPackets[i].isMissing = !_sentPackets[i].isAcknowledged;
+    }
+
+    while (!_sentPackets.empty() && _sentPackets.front().isAcknowledged)
+    {
+        _sentPackets.pop_front();
+    }
 }
 
-void NetworkConnection::sendAcknowledgePacket(sequence_t sequence)
+void NetworkConnection::sendAcknowledgePacket()
 {
     Packet packet;
     packet.header.kind = PacketKind::ack;
-    packet.header.sequence = sequence;
     packet.header.dataSize = 0;
-    sendPacket(packet);
+    transmitPacket(packet, false);
 }
 
-void NetworkConnection::resendUndeliveredPackets()
+void NetworkConnection::transmitUndeliveredPackets()
 {
     std::unique_lock<std::mutex> lk(_sentPacketsSync);
     auto now = getTime();
-    auto timestamp = now - kRedeliverTimeout;
 
-    for (size_t i = 0; i < _sentPackets.size(); i++)
+    const auto numInWindow = std::min(_sentPackets.size(), kWindowSize);
+    for (size_t i = 0; i < numInWindow; i++)
     {
         auto& sentPacket = _sentPackets[i];
-        if (sentPacket.timestamp < timestamp)
+        if (!sentPacket.isTransmitted)
         {
-            size_t packetSize = sizeof(PacketHeader) + sentPacket.packet.header.dataSize;
-            _socket->sendData(*_endpoint, &sentPacket.packet, packetSize);
-            logPacket(sentPacket.packet, true, true);
-
+            transmitPacket(sentPacket.packet, false);
+            sentPacket.isTransmitted = true;
+            sentPacket.timestamp = now;
+        }
+        else if (!sentPacket.isAcknowledged && now - sentPacket.timestamp > (sentPacket.isMissing ? kMissingRedeliverTimeout : kRedeliverTimeout))
+        {
+            transmitPacket(sentPacket.packet, true);
             sentPacket.timestamp = now;
         }
     }
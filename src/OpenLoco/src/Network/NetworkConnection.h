@@ -3,6 +3,7 @@
 #include "Network.h"
 #include "Packet.h"
 #include "Socket.h"
+#include <bitset>
 #include <cassert>
 #include <cstdint>
 #include <deque>
@@ -14,12 +15,26 @@
 
 namespace OpenLoco::Network
 {
+    /**
+     * Reliable delivery of packets over UDP. Every packet carries a cumulative and selective
+     * acknowledgement of what has been received from the other side, a separate ACK packet is only
+     * sent when nothing else has gone out for a while. Packets are handed out in the order they
+     * arrived in, duplicates are dropped.
+     */
     class NetworkConnection
     {
     private:
+        // Packets more than this far ahead of the oldest missing one are dropped, so no more than
+        // this many are ever in flight
+        static constexpr size_t kWindowSize = 4096;
+
         struct SentPacket
         {
             uint32_t timestamp;
+            bool isTransmitted;
+            bool isAcknowledged;
+            // Packets after it have been acknowledged, so it has most likely been lost
+            bool isMissing;
             Packet packet;
         };
 
@@ -27,18 +42,27 @@ namespace OpenLoco::Network
         std::unique_ptr<INetworkEndpoint> _endpoint;
         std::mutex _sentPacketsSync;
         std::mutex _receivedPacketsSync;
-        std::vector<SentPacket> _sentPackets;
+        std::mutex _receiveWindowSync;
+        // Unacknowledged packets, in order of sequence without any gaps. Those past the window
+        // have not been transmitted yet.
+        std::deque<SentPacket> _sentPackets;
         std::queue<Packet> _receivedPackets;
-        std::deque<sequence_t> _receivedSequences;
-        uint16_t _sendSequence{};
+        // Which sequences of the window starting at _receiveSequence have been received, indexed by
+        // sequence modulo the window size
+        std::bitset<kWindowSize> _receivedSequences;
+        sequence_t _receiveSequence{};
+        uint32_t _numUnacknowledgedPackets{};
+        sequence_t _sendSequence{};
         uint32_t _timeOfLastReceivedPacket{};
 
         static uint32_t getTime();
-        bool checkOrRecordReceivedSequence(sequence_t sequence);
-        void receiveAcknowledgePacket(sequence_t sequence);
-        void sendAcknowledgePacket(sequence_t sequence);
-        void resendUndeliveredPackets();
+        bool recordReceivedSequence(sequence_t sequence);
+        void writeAcknowledgement(PacketHeader& header);
+        void receiveAcknowledgement(sequence_t ack, uint32_t ackBits);
+        void sendAcknowledgePacket();
+        void transmitUndeliveredPackets();
         void sendPacket(PacketKind kind, size_t dataSize, const void* packetData);
+        void transmitPacket(Packet& packet, bool resend);
         void logPacket(const Packet& packet, bool sent, bool resend);
 
     public:
@@ -48,7 +72,6 @@ namespace OpenLoco::Network
         bool hasTimedOut() const;
         void update();
         void receivePacket(const Packet& packet);
-        void sendPacket(const Packet& packet);
         std::optional<Packet> takeNextPacket();
 
         template<typename T>
@@ -228,6 +228,10 @@ void NetworkServer::sendPings()
         packet.tick = gameState.scenarioTicks;
         packet.srand0 = gameState.rng.srand_0();
         packet.srand1 = gameState.rng.srand_1();
+        if (!_clients.empty())
+        {
+            packet.checksums = computeStateChecksums();
+        }
         for (auto& client : _clients)
         {
             client->connection->sendPacket(packet);
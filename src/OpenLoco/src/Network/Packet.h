@@ -5,6 +5,7 @@
 #include <string_view>
 
 #include "Network.h"
+#include "StateChecksum.h"
 #include <OpenLoco/Interop/Interop.hpp>
 
 namespace OpenLoco::Network
@@ -31,6 +32,10 @@ namespace OpenLoco::Network
     {
         PacketKind kind{};
         sequence_t sequence{};
+        // Every packet before this sequence has been received by the sender of this one
+        sequence_t ack{};
+        // Which of the 32 sequences after ack have been received as well, lowest bit first
+        uint32_t ackBits{};
         uint16_t dataSize{};
     };
 
@@ -67,6 +72,7 @@ namespace OpenLoco::Network
         uint32_t tick{};
         uint32_t srand0{};
         uint32_t srand1{};
+        StateChecksums checksums{};
     };
 
     struct ConnectPacket
@@ -1,4 +1,5 @@
 #include <OpenLoco/Core/Exception.hpp>
+#include <algorithm>
 #include <atomic>
 #include <cassert>
 #include <chrono>
@@ -527,6 +528,11 @@ namespace OpenLoco::Network
             return _hostName.empty() ? nullptr : _hostName.c_str();
         }
 
+        SOCKET getSocket() const
+        {
+            return _socket;
+        }
+
         Protocol getProtocol() const override
         {
             NetworkEndpoint endpoint(&_listeningAddress, _listeningAddressLen);
@@ -625,5 +631,37 @@ namespace OpenLoco::Network
             BaseSocket::resolveAddress(protocol, address, port, &ss, &ssLen);
             return std::make_unique<NetworkEndpoint>(reinterpret_cast<const sockaddr*>(&ss), ssLen);
         }
+
+        bool waitForData(const std::vector<std::unique_ptr<IUdpSocket>>& sockets, uint32_t timeoutMs)
+        {
+            fd_set readSet;
+            FD_ZERO(&readSet);
+            SOCKET maxSocket = INVALID_SOCKET;
+            bool hasSocket = false;
+            for (const auto& socket : sockets)
+            {
+                const auto* udpSocket = dynamic_cast<const UdpSocket*>(socket.get());
+                if (udpSocket == nullptr || udpSocket->getSocket() == INVALID_SOCKET)
+                {
+                    continue;
+                }
+                FD_SET(udpSocket->getSocket(), &readSet);
+                maxSocket = hasSocket ? std::max(maxSocket, udpSocket->getSocket()) : udpSocket->getSocket();
+                hasSocket = true;
+            }
+
+            // Nothing to wait on yet, e.g. a client socket is only created once something is sent
+            if (!hasSocket)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMs));
+                return false;
+            }
+
+            timeval timeout{};
+            timeout.tv_sec = static_cast<decltype(timeout.tv_sec)>(timeoutMs / 1000);
+            timeout.tv_usec = static_cast<decltype(timeout.tv_usec)>((timeoutMs % 1000) * 1000);
+            // The first argument is ignored on Windows
+            return select(static_cast<int>(maxSocket + 1), &readSet, nullptr, nullptr, &timeout) > 0;
+        }
     }
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -77,5 +78,11 @@ namespace OpenLoco::Network
     {
         [[nodiscard]] std::unique_ptr<IUdpSocket> createUdp();
         std::unique_ptr<INetworkEndpoint> resolve(Protocol protocol, const std::string& address, uint16_t port);
+
+        /**
+         * Blocks until any of the sockets has data to receive or the timeout has passed.
+         * Returns false on timeout.
+         */
+        bool waitForData(const std::vector<std::unique_ptr<IUdpSocket>>& sockets, uint32_t timeoutMs);
     }
 }
@@ -0,0 +1,235 @@
+#include "StateChecksum.h"
+#include "GameState.h"
+#include "Map/TileManager.h"
+#include "Vehicles/Vehicle.h"
+#include <bit>
+#include <cstring>
+#include <functional>
+#include <future>
+
+namespace OpenLoco::Network
+{
+    // Word at a time hash (murmur3 mixing) so the full state can be hashed every ping
+    class ChecksumBuilder
+    {
+    private:
+        uint32_t _hash = 0x811C9DC5U;
+
+        void mix(uint32_t word)
+        {
+            word *= 0xCC9E2D51U;
+            word = std::rotl(word, 15);
+            word *= 0x1B873593U;
+            _hash ^= word;
+            _hash = std::rotl(_hash, 13);
+            _hash = _hash * 5 + 0xE6546B64U;
+        }
+
+    public:
+        void append(const void* data, size_t size)
+        {
+            const auto* bytes = static_cast<const uint8_t*>(data);
+            for (; size >= sizeof(uint32_t); size -= sizeof(uint32_t), bytes += sizeof(uint32_t))
+            {
+                uint32_t word;
+                std::memcpy(&word, bytes, sizeof(word));
+                mix(word);
+            }
+            uint32_t tail = 0;
+            for (size_t i = 0; i < size; ++i)
+            {
+                tail |= static_cast<uint32_t>(bytes[i]) << (i * 8);
+            }
+            mix(tail);
+        }
+
+        template<typename T>
+        void appendObject(const T& obj)
+        {
+            append(&obj, sizeof(T));
+        }
+
+        // Appends all of obj apart from the bytes [first, last)
+        template<typename T>
+        void appendExcluding(const T& obj, const void* first, const void* last)
+        {
+            const auto* begin = reinterpret_cast<const uint8_t*>(&obj);
+            const auto* excludeBegin = static_cast<const uint8_t*>(first);
+            const auto* excludeEnd = static_cast<const uint8_t*>(last);
+            append(begin, excludeBegin - begin);
+            append(excludeEnd, (begin + sizeof(T)) - excludeEnd);
+        }
+
+        uint32_t get() const
+        {
+            // Final avalanche
+            auto hash = _hash;
+            hash ^= hash >> 16;
+            hash *= 0x85EBCA6BU;
+            hash ^= hash >> 13;
+            hash *= 0xC2B2AE35U;
+            hash ^= hash >> 16;
+            return hash;
+        }
+    };
+
+    static uint32_t computeGeneralChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        // Prngs, flags and date; the saved view that follows is local to each peer
+        builder.append(&state.rng, reinterpret_cast<const uint8_t*>(&state.savedViewX) - reinterpret_cast<const uint8_t*>(&state.rng));
+        builder.appendObject(state.entityListHeads);
+        builder.appendObject(state.entityListCounts);
+        builder.appendObject(state.scenarioTicks);
+        builder.appendObject(state.scenarioTicks2);
+        builder.appendObject(state.numMapAnimations);
+        builder.appendObject(state.currentSnowLine);
+        builder.appendObject(state.currentSeason);
+        builder.appendObject(state.orderTableLength);
+        builder.appendObject(state.scenarioObjectiveProgress);
+        builder.appendObject(state.industryFlags);
+        builder.appendObject(state.companyRecords);
+        builder.appendObject(state.currentRainLevel);
+        return builder.get();
+    }
+
+    static uint32_t computeCompaniesChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        builder.appendObject(state.companies);
+        return builder.get();
+    }
+
+    static uint32_t computeTownsChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        for (const auto& town : state.towns)
+        {
+            // Label frames are screen positions that depend on the local view
+            builder.appendExcluding(town, &town.labelFrame, &town.labelFrame + 1);
+        }
+        return builder.get();
+    }
+
+    static uint32_t computeIndustriesChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        builder.appendObject(state.industries);
+        return builder.get();
+    }
+
+    static uint32_t computeStationsChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        for (const auto& station : state.stations)
+        {
+            builder.appendExcluding(station, &station.labelFrame, &station.labelFrame + 1);
+        }
+        return builder.get();
+    }
+
+    static uint32_t computeEntitiesChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        for (const auto& entity : state.entities)
+        {
+            // Hashed from a copy with the fields that depend on the local view cleared
+            Entity copy = entity;
+
+            // The sprite bounds are in screen space so depend on the local view rotation
+            copy.spriteLeft = 0;
+            copy.spriteTop = 0;
+            copy.spriteRight = 0;
+            copy.spriteBottom = 0;
+
+            // Sound flags and window are set by the audio code for vehicles shown in a local viewport
+            auto* vehicle = copy.asBase<Vehicles::VehicleBase>();
+            if (vehicle != nullptr && vehicle->isVehicle2Or6())
+            {
+                auto* veh26 = vehicle->asVehicle2Or6();
+                veh26->soundFlags = Vehicles::SoundFlags::none;
+                veh26->soundWindowNumber = {};
+                veh26->soundWindowType = {};
+            }
+            builder.appendObject(copy);
+        }
+        return builder.get();
+    }
+
+    static uint32_t computeTilesChecksum()
+    {
+        ChecksumBuilder builder;
+        for (const auto& element : World::TileManager::getElements())
+        {
+            // Ghosts are construction previews that only exist on one peer
+            if (element.isGhost())
+            {
+                continue;
+            }
+            builder.appendObject(element);
+        }
+        return builder.get();
+    }
+
+    static uint32_t computeOtherChecksum(const GameState& state)
+    {
+        ChecksumBuilder builder;
+        builder.appendObject(state.animations);
+        builder.appendObject(state.waves);
+        builder.appendObject(state.userStrings);
+        builder.appendObject(state.routings);
+        builder.appendObject(state.orders);
+        return builder.get();
+    }
+
+    StateChecksums computeStateChecksums()
+    {
+        const auto& state = getGameState();
+
+        // Subsystems are independent blocks of memory so are hashed in parallel. The game
+        // loop is blocked until all of them are complete so the state can not change.
+        auto companies = std::async(std::launch::async, computeCompaniesChecksum, std::cref(state));
+        auto towns = std::async(std::launch::async, computeTownsChecksum, std::cref(state));
+        auto industries = std::async(std::launch::async, computeIndustriesChecksum, std::cref(state));
+        auto stations = std::async(std::launch::async, computeStationsChecksum, std::cref(state));
+        auto entities = std::async(std::launch::async, computeEntitiesChecksum, std::cref(state));
+        auto tiles = std::async(std::launch::async, computeTilesChecksum);
+        auto other = std::async(std::launch::async, computeOtherChecksum, std::cref(state));
+
+        StateChecksums checksums;
+        checksums.values[static_cast<size_t>(StateChecksumKind::general)] = computeGeneralChecksum(state);
+        checksums.values[static_cast<size_t>(StateChecksumKind::companies)] = companies.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::towns)] = towns.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::industries)] = industries.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::stations)] = stations.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::entities)] = entities.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::tiles)] = tiles.get();
+        checksums.values[static_cast<size_t>(StateChecksumKind::other)] = other.get();
+        return checksums;
+    }
+
+    std::string_view getStateChecksumName(StateChecksumKind kind)
+    {
+        switch (kind)
+        {
+            case StateChecksumKind::general:
+                return "general";
+            case StateChecksumKind::companies:
+                return "companies";
+            case StateChecksumKind::towns:
+                return "towns";
+            case StateChecksumKind::industries:
+                return "industries";
+            case StateChecksumKind::stations:
+                return "stations";
+            case StateChecksumKind::entities:
+                return "entities";
+            case StateChecksumKind::tiles:
+                return "tiles";
+            case StateChecksumKind::other:
+                return "other";
+            default:
+                return "unknown";
+        }
+    }
+}
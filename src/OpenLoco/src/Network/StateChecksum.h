@@ -0,0 +1,42 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace OpenLoco::Network
+{
+    enum class StateChecksumKind : uint8_t
+    {
+        general,
+        companies,
+        towns,
+        industries,
+        stations,
+        entities,
+        tiles,
+        other,
+        count,
+    };
+
+    /**
+     * Per subsystem checksums of the synchronised game state. Fields that differ between peers
+     * without affecting the simulation (views, label positions, ghost elements) are excluded.
+     */
+    struct StateChecksums
+    {
+        std::array<uint32_t, static_cast<size_t>(StateChecksumKind::count)> values{};
+
+        uint32_t get(StateChecksumKind kind) const
+        {
+            return values[static_cast<size_t>(kind)];
+        }
+
+        bool operator==(const StateChecksums&) const = default;
+    };
+    static_assert(sizeof(StateChecksums) == sizeof(uint32_t) * static_cast<size_t>(StateChecksumKind::count));
+
+    StateChecksums computeStateChecksums();
+
+    std::string_view getStateChecksumName(StateChecksumKind kind);
+}
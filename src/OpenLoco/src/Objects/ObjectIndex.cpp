@@ -33,8 +33,12 @@
 #include <OpenLoco/Diagnostics/Logging.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
+#include <future>
+#include <thread>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Diagnostics;
@@ -775,132 +779,176 @@ namespace OpenLoco::ObjectManager
         return entry;
     }
 
-    // 0x00472DA1
-    static void markInUseObjectsByTile(std::array<std::span<uint8_t>, kMaxObjectTypes>& loadedObjectFlags)
+    using LoadedObjectFlags = std::array<std::span<uint8_t>, kMaxObjectTypes>;
+
+    static LoadedObjectFlags splitFlagsByType(std::array<uint8_t, kMaxObjects>& allLoadedObjectFlags)
+    {
+        LoadedObjectFlags loadedObjectFlags;
+        auto count = 0;
+        for (uint8_t i = 0; i < kMaxObjectTypes; ++i)
+        {
+            const auto type = static_cast<ObjectType>(i);
+            loadedObjectFlags[i] = std::span<uint8_t>(allLoadedObjectFlags.begin() + count, getMaxObjects(type));
+            count += getMaxObjects(type);
+        }
+        return loadedObjectFlags;
+    }
+
+    static void markInUseObjectsByElement(const World::TileElement& el, LoadedObjectFlags& loadedObjectFlags)
     {
-        // Iterate the whole map looking for things
-        for (const auto pos : World::getWorldRange())
+        switch (el.type())
         {
-            const auto tile = World::TileManager::get(pos);
-            for (auto el : tile)
+            case World::ElementType::surface:
             {
-                auto* elSurface = el.as<World::SurfaceElement>();
-                auto* elTrack = el.as<World::TrackElement>();
-                auto* elStation = el.as<World::StationElement>();
-                auto* elSignal = el.as<World::SignalElement>();
-                auto* elBuilding = el.as<World::BuildingElement>();
-                auto* elTree = el.as<World::TreeElement>();
-                auto* elWall = el.as<World::WallElement>();
-                auto* elRoad = el.as<World::RoadElement>();
-                auto* elIndustry = el.as<World::IndustryElement>();
-
-                if (elSurface != nullptr)
+                const auto& elSurface = el.get<World::SurfaceElement>();
+                loadedObjectFlags[enumValue(ObjectType::land)][elSurface.terrain()] |= (1U << 0);
+                if (elSurface.var_4_E0())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::land)][elSurface->terrain()] |= (1U << 0);
-                    if (elSurface->var_4_E0())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::snow)][0] |= (1U << 0);
-                    }
+                    loadedObjectFlags[enumValue(ObjectType::snow)][0] |= (1U << 0);
                 }
-                else if (elTrack != nullptr)
+                break;
+            }
+            case World::ElementType::track:
+            {
+                const auto& elTrack = el.get<World::TrackElement>();
+                loadedObjectFlags[enumValue(ObjectType::track)][elTrack.trackObjectId()] |= (1U << 0);
+                if (elTrack.hasBridge())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::track)][elTrack->trackObjectId()] |= (1U << 0);
-                    if (elTrack->hasBridge())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::bridge)][elTrack->bridge()] |= (1U << 0);
-                    }
-                    for (auto i = 0U; i < 4; ++i)
-                    {
-                        if (elTrack->hasMod(i))
-                        {
-                            auto* trackObj = get<TrackObject>(elTrack->trackObjectId());
-                            loadedObjectFlags[enumValue(ObjectType::trackExtra)][trackObj->mods[i]] |= (1U << 0);
-                        }
-                    }
+                    loadedObjectFlags[enumValue(ObjectType::bridge)][elTrack.bridge()] |= (1U << 0);
                 }
-                else if (elStation != nullptr)
+                for (auto i = 0U; i < 4; ++i)
                 {
-                    switch (elStation->stationType())
+                    if (elTrack.hasMod(i))
                     {
-                        case StationType::trainStation:
-                            loadedObjectFlags[enumValue(ObjectType::trainStation)][elStation->objectId()] |= (1U << 0);
-                            break;
-                        case StationType::roadStation:
-                            loadedObjectFlags[enumValue(ObjectType::roadStation)][elStation->objectId()] |= (1U << 0);
-                            break;
-                        case StationType::airport:
-                            loadedObjectFlags[enumValue(ObjectType::airport)][elStation->objectId()] |= (1U << 0);
-                            break;
-                        case StationType::docks:
-                            loadedObjectFlags[enumValue(ObjectType::dock)][elStation->objectId()] |= (1U << 0);
-                            break;
+                        auto* trackObj = get<TrackObject>(elTrack.trackObjectId());
+                        loadedObjectFlags[enumValue(ObjectType::trackExtra)][trackObj->mods[i]] |= (1U << 0);
                     }
                 }
-                else if (elSignal != nullptr)
+                break;
+            }
+            case World::ElementType::station:
+            {
+                const auto& elStation = el.get<World::StationElement>();
+                switch (elStation.stationType())
                 {
-                    if (elSignal->getLeft().hasSignal())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::trackSignal)][elSignal->getLeft().signalObjectId()] |= (1U << 0);
-                    }
-                    if (elSignal->getRight().hasSignal())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::trackSignal)][elSignal->getRight().signalObjectId()] |= (1U << 0);
-                    }
+                    case StationType::trainStation:
+                        loadedObjectFlags[enumValue(ObjectType::trainStation)][elStation.objectId()] |= (1U << 0);
+                        break;
+                    case StationType::roadStation:
+                        loadedObjectFlags[enumValue(ObjectType::roadStation)][elStation.objectId()] |= (1U << 0);
+                        break;
+                    case StationType::airport:
+                        loadedObjectFlags[enumValue(ObjectType::airport)][elStation.objectId()] |= (1U << 0);
+                        break;
+                    case StationType::docks:
+                        loadedObjectFlags[enumValue(ObjectType::dock)][elStation.objectId()] |= (1U << 0);
+                        break;
                 }
-                else if (elBuilding != nullptr)
+                break;
+            }
+            case World::ElementType::signal:
+            {
+                const auto& elSignal = el.get<World::SignalElement>();
+                if (elSignal.getLeft().hasSignal())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::building)][elBuilding->objectId()] |= (1U << 0);
-                    if (!elBuilding->isConstructed())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::scaffolding)][0] |= (1U << 0);
-                    }
+                    loadedObjectFlags[enumValue(ObjectType::trackSignal)][elSignal.getLeft().signalObjectId()] |= (1U << 0);
                 }
-                else if (elTree != nullptr)
+                if (elSignal.getRight().hasSignal())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::tree)][elTree->treeObjectId()] |= (1U << 0);
+                    loadedObjectFlags[enumValue(ObjectType::trackSignal)][elSignal.getRight().signalObjectId()] |= (1U << 0);
                 }
-                else if (elWall != nullptr)
+                break;
+            }
+            case World::ElementType::building:
+            {
+                const auto& elBuilding = el.get<World::BuildingElement>();
+                loadedObjectFlags[enumValue(ObjectType::building)][elBuilding.objectId()] |= (1U << 0);
+                if (!elBuilding.isConstructed())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::wall)][elWall->wallObjectId()] |= (1U << 0);
+                    loadedObjectFlags[enumValue(ObjectType::scaffolding)][0] |= (1U << 0);
                 }
-                else if (elRoad != nullptr)
+                break;
+            }
+            case World::ElementType::tree:
+                loadedObjectFlags[enumValue(ObjectType::tree)][el.get<World::TreeElement>().treeObjectId()] |= (1U << 0);
+                break;
+            case World::ElementType::wall:
+                loadedObjectFlags[enumValue(ObjectType::wall)][el.get<World::WallElement>().wallObjectId()] |= (1U << 0);
+                break;
+            case World::ElementType::road:
+            {
+                const auto& elRoad = el.get<World::RoadElement>();
+                loadedObjectFlags[enumValue(ObjectType::road)][elRoad.roadObjectId()] |= (1U << 0);
+                if (elRoad.hasBridge())
                 {
-                    loadedObjectFlags[enumValue(ObjectType::road)][elRoad->roadObjectId()] |= (1U << 0);
-                    if (elRoad->hasBridge())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::bridge)][elRoad->bridge()] |= (1U << 0);
-                    }
-                    if (elRoad->hasLevelCrossing())
-                    {
-                        loadedObjectFlags[enumValue(ObjectType::levelCrossing)][elRoad->levelCrossingObjectId()] |= (1U << 0);
-                    }
-                    else
+                    loadedObjectFlags[enumValue(ObjectType::bridge)][elRoad.bridge()] |= (1U << 0);
+                }
+                if (elRoad.hasLevelCrossing())
+                {
+                    loadedObjectFlags[enumValue(ObjectType::levelCrossing)][elRoad.levelCrossingObjectId()] |= (1U << 0);
+                }
+                else
+                {
+                    if (elRoad.streetLightStyle() != 0)
                     {
-                        if (elRoad->streetLightStyle() != 0)
-                        {
-                            loadedObjectFlags[enumValue(ObjectType::streetLight)][0] |= (1U << 0);
-                        }
+                        loadedObjectFlags[enumValue(ObjectType::streetLight)][0] |= (1U << 0);
                     }
+                }
 
-                    auto* roadObj = get<RoadObject>(elRoad->roadObjectId());
-                    if (!roadObj->hasFlags(RoadObjectFlags::unk_03))
+                auto* roadObj = get<RoadObject>(elRoad.roadObjectId());
+                if (!roadObj->hasFlags(RoadObjectFlags::unk_03))
+                {
+                    for (auto i = 0U; i < 2; ++i)
                     {
-                        for (auto i = 0U; i < 2; ++i)
+                        if (elRoad.hasMod(i))
                         {
-                            if (elRoad->hasMod(i))
-                            {
-                                loadedObjectFlags[enumValue(ObjectType::roadExtra)][roadObj->mods[i]] |= (1U << 0);
-                            }
+                            loadedObjectFlags[enumValue(ObjectType::roadExtra)][roadObj->mods[i]] |= (1U << 0);
                         }
                     }
                 }
-                else if (elIndustry != nullptr)
+                break;
+            }
+            case World::ElementType::industry:
+                if (!el.get<World::IndustryElement>().isConstructed())
+                {
+                    loadedObjectFlags[enumValue(ObjectType::scaffolding)][0] |= (1U << 0);
+                }
+                break;
+        }
+    }
+
+    // 0x00472DA1
+    static void markInUseObjectsByTile(std::array<uint8_t, kMaxObjects>& allLoadedObjectFlags)
+    {
+        // Iterate the whole map looking for things. Nothing changes the map while the selection list
+        // is prepared so bands of rows are scanned in parallel, each marking its own copy of the
+        // flags, and the copies are merged afterwards.
+        const auto numBands = std::clamp<int32_t>(std::thread::hardware_concurrency(), 1, World::kMapRows);
+        const auto rowsPerBand = (World::kMapRows + numBands - 1) / numBands;
+        std::vector<std::future<std::array<uint8_t, kMaxObjects>>> bands;
+        for (tile_coord_t top = 0; top < World::kMapRows; top += rowsPerBand)
+        {
+            const auto bottom = static_cast<tile_coord_t>(std::min<int32_t>(top + rowsPerBand, World::kMapRows));
+            bands.push_back(std::async(std::launch::async, [top, bottom]() {
+                std::array<uint8_t, kMaxObjects> bandFlags{};
+                auto loadedObjectFlags = splitFlagsByType(bandFlags);
+                for (const auto pos : World::TilePosRangeView({ 0, top }, { World::kMapColumns - 1, static_cast<tile_coord_t>(bottom - 1) }))
                 {
-                    if (!elIndustry->isConstructed())
+                    const auto tile = World::TileManager::get(pos);
+                    for (const auto& el : tile)
                     {
-                        loadedObjectFlags[enumValue(ObjectType::scaffolding)][0] |= (1U << 0);
+                        markInUseObjectsByElement(el, loadedObjectFlags);
                     }
                 }
+                return bandFlags;
+            }));
+        }
+        for (auto& band : bands)
+        {
+            const auto bandFlags = band.get();
+            for (size_t i = 0; i < bandFlags.size(); i++)
+            {
+                allLoadedObjectFlags[i] |= bandFlags[i];
             }
         }
     }
@@ -940,7 +988,7 @@ namespace OpenLoco::ObjectManager
     }
 
     // 0x00472D70
-    static void markLoadedObjects(std::array<std::span<uint8_t>, kMaxObjectTypes>& loadedObjectFlags)
+    static void markLoadedObjects(LoadedObjectFlags& loadedObjectFlags)
     {
         for (uint8_t i = 0; i < kMaxObjectTypes; ++i)
         {
@@ -959,21 +1007,14 @@ namespace OpenLoco::ObjectManager
     static void markInUseObjects(std::span<SelectedObjectsFlags> objectFlags)
     {
         std::array<uint8_t, kMaxObjects> allLoadedObjectFlags{};
-        std::array<std::span<uint8_t>, kMaxObjectTypes> loadedObjectFlags;
-        auto count = 0;
-        for (uint8_t i = 0; i < kMaxObjectTypes; ++i)
-        {
-            const auto type = static_cast<ObjectType>(i);
-            loadedObjectFlags[i] = std::span<uint8_t>(allLoadedObjectFlags.begin() + count, getMaxObjects(type));
-            count += getMaxObjects(type);
-        }
+        auto loadedObjectFlags = splitFlagsByType(allLoadedObjectFlags);
 
         markLoadedObjects(loadedObjectFlags);
 
         if ((addr<0x00525E28, uint32_t>() & 1) != 0)
         {
             loadedObjectFlags[enumValue(ObjectType::region)][0] |= (1U << 0);
-            markInUseObjectsByTile(loadedObjectFlags);
+            markInUseObjectsByTile(allLoadedObjectFlags);
         }
 
         markInUseVehicleObjects(loadedObjectFlags[enumValue(ObjectType::vehicle)]);
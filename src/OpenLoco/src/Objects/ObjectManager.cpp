@@ -337,6 +337,9 @@ namespace OpenLoco::ObjectManager
             }
         }
 
+        // Language changes also reload through here, drop text rasterised with the old glyphs
+        Gfx::getDrawingEngine().getDrawingContext().clearGlyphCache();
+
         Logging::verbose("Loaded {} objects in {} milliseconds.", loadedObjects, reloadTimer.elapsed());
     }
 
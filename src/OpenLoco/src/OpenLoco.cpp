@@ -34,6 +34,7 @@
 #include "Entities/EntityTweener.h"
 #include "Environment.h"
 #include "Game.h"
+#include "GameCommands/CommandLog.h"
 #include "GameException.hpp"
 #include "GameState.h"
 #include "GameStateFlags.h"
@@ -50,6 +51,7 @@
 #include "Localisation/StringIds.h"
 #include "Logging.h"
 #include "Map/AnimationManager.h"
+#include "Map/MapGenerator/MapGenerator.h"
 #include "Map/TileManager.h"
 #include "Map/WaveManager.h"
 #include "MessageManager.h"
@@ -58,6 +60,7 @@
 #include "Objects/ObjectIndex.h"
 #include "Objects/ObjectManager.h"
 #include "OpenLoco.h"
+#include "Paint/PaintPickBuffer.h"
 #include "Random.h"
 #include "S5/S5.h"
 #include "ScenarioManager.h"
@@ -66,14 +69,21 @@
 #include "Tutorial.h"
 #include "Ui.h"
 #include "Ui/ProgressBar.h"
+#include "Ui/Screenshot.h"
 #include "Ui/WindowManager.h"
+#include "Viewport.hpp"
+#include "Vehicles/TrackOccupancy.h"
+#include "Vehicles/TrackPathfinding.h"
 #include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/IndustryManager.h"
+#include "World/IndustrySurfaces.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Crash.h>
 #include <OpenLoco/Platform/Platform.h>
@@ -210,6 +220,7 @@ namespace OpenLoco
     // 0x004BE65E
     [[noreturn]] void exitCleanly()
     {
+        GameCommands::CommandLog::stopRecording();
         Audio::disposeDSound();
         Audio::close();
         Ui::disposeCursors();
@@ -343,6 +354,10 @@ namespace OpenLoco
     static void launchGame()
     {
         const auto& cmdLineOptions = getCommandLineOptions();
+        if (!cmdLineOptions.recordPath.empty())
+        {
+            GameCommands::CommandLog::startRecording(fs::u8path(cmdLineOptions.recordPath));
+        }
         if (cmdLineOptions.action == CommandLineAction::host)
         {
             Network::openServer();
@@ -492,11 +507,12 @@ namespace OpenLoco
     static void tickInterrupted()
     {
         EntityTweener::get().reset();
+        GameCommands::CommandLog::endTick();
         Logging::info("Tick interrupted");
     }
 
     // 0x0046A794
-    static void tick()
+    static void runTick()
     {
         static bool isInitialised = false;
 
@@ -737,6 +753,14 @@ namespace OpenLoco
         }
     }
 
+    static void tick()
+    {
+        // Outside of runTick as the zone must not be jumped over when the tick is interrupted. Ending it
+        // also restores the profiler depth of any zone within the tick that was jumped over.
+        OPENLOCO_PROFILE_SCOPE("tick");
+        runTick();
+    }
+
     static void tickLogic(int32_t count)
     {
         for (int32_t i = 0; i < count; i++)
@@ -769,6 +793,9 @@ namespace OpenLoco
         if (!Network::shouldProcessTick(ScenarioManager::getScenarioTicks() + 1))
             return;
 
+        OPENLOCO_PROFILE_SCOPE("tickLogic");
+
+        GameCommands::CommandLog::beginTick();
         ScenarioManager::setScenarioTicks(ScenarioManager::getScenarioTicks() + 1);
         ScenarioManager::setScenarioTicks2(ScenarioManager::getScenarioTicks2() + 1);
         Network::processGameCommands(ScenarioManager::getScenarioTicks());
@@ -808,6 +835,7 @@ namespace OpenLoco
             }
             _loadErrorCode = 0;
         }
+        GameCommands::CommandLog::endTick();
     }
 
     static void autosaveReset()
@@ -1115,7 +1143,7 @@ namespace OpenLoco
         _glpCmdLine = "";
     }
 
-    void simulateGame(const fs::path& path, int32_t ticks)
+    static void loadForSimulation(const fs::path& path)
     {
         Config::read();
         Environment::resolvePaths();
@@ -1142,9 +1170,118 @@ namespace OpenLoco
                 Logging::info("File loaded. Starting simulation.");
             }
         }
+    }
+
+    void simulateGame(const fs::path& path, int32_t ticks)
+    {
+        loadForSimulation(path);
         tickLogic(ticks);
     }
 
+    void screenshotGame(const fs::path& path, const fs::path& outputPath, uint8_t zoomLevel)
+    {
+        loadForSimulation(path);
+        Ui::saveGiantScreenshot(outputPath, zoomLevel);
+    }
+
+    uint32_t pickCheckGame(const fs::path& path, uint8_t zoomLevel)
+    {
+        loadForSimulation(path);
+
+        // Ensure sprites appear regardless of rotation
+        EntityManager::resetSpatialIndex();
+
+        auto viewport = Ui::createMapCentreViewport(1920, 1080, zoomLevel);
+        return Paint::PickBuffer::verify(viewport, 16);
+    }
+
+    // Compares every index kept up to date by the game with a full scan, logs the first difference
+    static bool verifyIndices()
+    {
+        if (!Vehicles::TrackOccupancy::verify())
+        {
+            Logging::error("Track occupancy index diverged at tick {}", ScenarioManager::getScenarioTicks());
+            return false;
+        }
+        if (!Vehicles::TrackPathfinding::verify())
+        {
+            Logging::error("Route choice diverged from the original at tick {}", ScenarioManager::getScenarioTicks());
+            return false;
+        }
+        if (!CompanyOwnership::verify())
+        {
+            Logging::error("Company ownership index diverged at tick {}", ScenarioManager::getScenarioTicks());
+            return false;
+        }
+        if (!TownManager::verifyBuildingRegistry())
+        {
+            Logging::error("Town building registry diverged at tick {}", ScenarioManager::getScenarioTicks());
+            return false;
+        }
+        if (!IndustrySurfaces::verify())
+        {
+            Logging::error("Claimed industry surfaces diverged at tick {}", ScenarioManager::getScenarioTicks());
+            return false;
+        }
+        return true;
+    }
+
+    bool treeCheckGame(const fs::path& path, std::optional<uint32_t> seed)
+    {
+        loadForSimulation(path);
+        const auto rng = seed.has_value() ? Core::Prng(*seed, *seed) : gPrng1();
+        return World::MapGenerator::verifyTreePlanter(rng);
+    }
+
+    bool replayGame(const fs::path& path, bool verify)
+    {
+        using namespace GameCommands::CommandLog;
+
+        const auto log = readLog(path);
+        loadForSimulation(getSavePath(path));
+        if (ScenarioManager::getScenarioTicks() != log.startTick)
+        {
+            Logging::error("Starting save is at tick {}, expected {}", ScenarioManager::getScenarioTicks(), log.startTick);
+            return false;
+        }
+
+        // Every route choice at a junction is also made by the original to catch any difference as it happens
+        Vehicles::TrackPathfinding::setCompareWithOriginal(verify);
+
+        // Commands logged at a tick were issued after it had run, checkpoints are taken once they have been applied
+        size_t nextCommand = 0;
+        for (const auto& checkpoint : log.checkpoints)
+        {
+            while (true)
+            {
+                const auto tick = ScenarioManager::getScenarioTicks();
+                for (; nextCommand < log.commands.size() && log.commands[nextCommand].tick == tick; nextCommand++)
+                {
+                    const auto& logged = log.commands[nextCommand];
+                    GameCommands::setUpdatingCompanyId(logged.company);
+                    GameCommands::doCommand(logged.command, logged.regs);
+                }
+                if (tick >= checkpoint.tick)
+                {
+                    break;
+                }
+                tickLogic();
+
+                if (verify && !verifyIndices())
+                {
+                    return false;
+                }
+            }
+
+            if (!verifyCheckpoint(checkpoint))
+            {
+                Logging::error("Replay diverged at tick {} after {} commands", checkpoint.tick, nextCommand);
+                return false;
+            }
+        }
+        return true;
+    }
+
     // 0x00406D13
     static int main(const CommandLineOptions& options)
     {
@@ -1167,6 +1304,8 @@ namespace OpenLoco
             CrashHandler::AppInfo appInfo;
             appInfo.name = "OpenLoco";
             appInfo.version = getVersionInfo();
+            // Bounded as the log writer may never catch up, e.g. if the crash is on its thread
+            appInfo.onCrash = []() { Logging::flush(std::chrono::seconds(2)); };
 
             _exHandler = CrashHandler::init(appInfo);
         }
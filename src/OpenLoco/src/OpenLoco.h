@@ -3,6 +3,7 @@
 #include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <string>
 
 namespace OpenLoco
@@ -23,6 +24,15 @@ namespace OpenLoco
     void* hInstance();
     void initialiseViewports();
     void simulateGame(const fs::path& path, int32_t ticks);
+    // Replays a log recorded with --record from its starting save, returns false if it diverges. verify
+    // also checks the game's indices and route choices against the original after every tick.
+    bool replayGame(const fs::path& path, bool verify);
+    void screenshotGame(const fs::path& path, const fs::path& outputPath, uint8_t zoomLevel);
+    // Compares the pick buffer with paint session hit testing of a view of the save, returns the number of differences
+    uint32_t pickCheckGame(const fs::path& path, uint8_t zoomLevel);
+    // Checks that landscape generation plants the same trees with TreePlanter as through the game
+    // command, from seed or the save's own random state
+    bool treeCheckGame(const fs::path& path, std::optional<uint32_t> seed);
 
     void sub_431695(uint16_t var_F253A0);
     int main(std::vector<std::string>&& argv);
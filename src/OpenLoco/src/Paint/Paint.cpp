@@ -7,16 +7,25 @@
 #include "Localisation/FormatArguments.hpp"
 #include "Localisation/Formatting.h"
 #include "Localisation/StringManager.h"
+#include "Map/MapSelection.h"
 #include "Map/SurfaceElement.h"
 #include "Map/TileManager.h"
 #include "PaintEntity.h"
+#include "PaintPickBuffer.h"
 #include "PaintTile.h"
+#include "ScenarioManager.h"
 #include "Ui/ViewportInteraction.h"
 #include "Ui/WindowManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <optional>
+#include <vector>
 
 using namespace OpenLoco::Interop;
 using namespace OpenLoco::Ui::ViewportInteraction;
@@ -127,6 +136,27 @@ namespace OpenLoco::Paint
         return 0;
     }
 
+    // What the tile elements of each location added to the quadrants and string list. While the static
+    // layer is generated these are held back and only added once the entities of the location before
+    // them have been painted (see PaintSession::generateEntities). Tile elements always start a location
+    // with a parent so they never attach to the entity painted before them.
+    struct StaticLayerLocation
+    {
+        uint32_t quadrantEntriesEnd;
+        uint32_t stringsEnd;
+        PaintStruct* lastPS;
+    };
+
+    struct StaticLayerInsertions
+    {
+        std::vector<PaintStruct*> quadrantEntries;
+        std::vector<PaintStringStruct*> strings;
+        std::vector<StaticLayerLocation> locations;
+    };
+
+    static StaticLayerInsertions _staticLayerInsertions;
+    static bool _isGeneratingStaticLayer = false;
+
     void PaintSession::addPSToQuadrant(PaintStruct& ps)
     {
         const auto positionHash = remapPositionToQuadrant(ps, currentRotation);
@@ -135,6 +165,17 @@ namespace OpenLoco::Paint
         const uint32_t paintQuadrantIndex = std::clamp(positionHash / World::kTileSize, 0, kMaxPaintQuadrants - 1);
 
         ps.quadrantIndex = paintQuadrantIndex;
+        if (_isGeneratingStaticLayer)
+        {
+            _staticLayerInsertions.quadrantEntries.push_back(&ps);
+            return;
+        }
+        linkToQuadrant(ps);
+    }
+
+    void PaintSession::linkToQuadrant(PaintStruct& ps)
+    {
+        const uint32_t paintQuadrantIndex = ps.quadrantIndex;
         ps.nextQuadrantPS = _quadrants[paintQuadrantIndex];
         _quadrants[paintQuadrantIndex] = &ps;
 
@@ -237,22 +278,86 @@ namespace OpenLoco::Paint
         return addToPlotListAsParent(imageId, offset, boundBoxOffset, boundBoxSize);
     }
 
-    // 0x004FD200
-    void PaintSession::addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    // Moves the start of the bound box so that it does not begin outside of the rt horizontally
+    static void shrinkBoundBoxToRT(PaintStructBoundBox& bounds, const Gfx::RenderTarget& rt, const uint8_t rotation)
     {
-        registers regs;
-        regs.ebx = imageId.toUInt32();
-        regs.al = offset.x;
-        regs.cl = offset.y;
-        regs.dx = offset.z;
-        regs.di = boundBoxSize.x;
-        regs.si = boundBoxSize.y;
-        regs.ah = boundBoxSize.z;
+        const int16_t left = rt.x;
+        const int16_t right = rt.x + rt.width;
+        switch (rotation)
+        {
+            case 0:
+            {
+                const int16_t beforeLeft = bounds.y - bounds.x - left;
+                if (beforeLeft < 0)
+                {
+                    bounds.y -= beforeLeft;
+                }
+                const int16_t afterRight = bounds.y - bounds.x - right;
+                if (afterRight > 0)
+                {
+                    bounds.x += afterRight;
+                }
+                break;
+            }
+            case 1:
+            {
+                const int16_t beforeLeft = -bounds.y - bounds.x - left;
+                if (beforeLeft < 0)
+                {
+                    bounds.x += beforeLeft;
+                }
+                const int16_t afterRight = -bounds.y - bounds.x - right;
+                if (afterRight > 0)
+                {
+                    bounds.y += afterRight;
+                }
+                break;
+            }
+            case 2:
+            {
+                const int16_t beforeLeft = bounds.x - bounds.y - left;
+                if (beforeLeft < 0)
+                {
+                    bounds.y += beforeLeft;
+                }
+                const int16_t afterRight = bounds.x - bounds.y - right;
+                if (afterRight > 0)
+                {
+                    bounds.x -= afterRight;
+                }
+                break;
+            }
+            case 3:
+            {
+                const int16_t beforeLeft = bounds.y + bounds.x - left;
+                if (beforeLeft < 0)
+                {
+                    bounds.x -= beforeLeft;
+                }
+                const int16_t afterRight = bounds.y + bounds.x - right;
+                if (afterRight > 0)
+                {
+                    bounds.y -= afterRight;
+                }
+                break;
+            }
+        }
+    }
 
-        setBoundingBoxOffset(boundBoxOffset);
+    // 0x004FD200
+    PaintStruct* PaintSession::addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize)
+    {
+        _lastPS = nullptr;
 
         // Similar to addToPlotListAsParent but shrinks the bound box based on the rt
-        call(_4FD200[currentRotation], regs);
+        auto* ps = createNormalPaintStruct(imageId, offset, boundBoxOffset, boundBoxSize);
+        if (ps != nullptr)
+        {
+            shrinkBoundBoxToRT(ps->bounds, **_renderTarget, currentRotation);
+            _lastPS = ps;
+            addPSToQuadrant(*ps);
+        }
+        return ps;
     }
 
     // 0x004FD1E0
@@ -328,8 +433,21 @@ namespace OpenLoco::Paint
     void PaintSession::init(Gfx::RenderTarget& rt, const SessionOptions& options)
     {
         _renderTarget = &rt;
-        _nextFreePaintStruct = &_paintEntries[0];
         _endOfPaintStructArray = &_paintEntries[3998];
+        resetPaintStructs();
+
+        _viewFlags = options.viewFlags;
+        currentRotation = options.rotation;
+        _cacheStaticLayer = options.cacheStaticLayer;
+        _staticLayerUsesTicks = false;
+
+        // TODO: unused
+        _foregroundCullingHeight = options.foregroundCullHeight;
+    }
+
+    void PaintSession::resetPaintStructs()
+    {
+        _nextFreePaintStruct = &_paintEntries[0];
         _lastPS = nullptr;
         for (auto& quadrant : _quadrants)
         {
@@ -339,12 +457,6 @@ namespace OpenLoco::Paint
         _quadrantFrontIndex = 0;
         _lastPaintString = 0;
         _paintStringHead = 0;
-
-        _viewFlags = options.viewFlags;
-        currentRotation = options.rotation;
-
-        // TODO: unused
-        _foregroundCullingHeight = options.foregroundCullHeight;
     }
 
     // 0x0045A6CA
@@ -392,8 +504,108 @@ namespace OpenLoco::Paint
         return session.addToPlotList4FD150(imageId, offset, boundingBoxOffset, boundingBoxSize);
     }
 
+    static PaintStringStruct* addToStringPlotListHookHelper(registers& regs, uint8_t rotation)
+    {
+        static loco_global<uint16_t, 0x00E3F0A8> _stringColour;
+
+        PaintSession session;
+        session.setRotation(rotation);
+        auto* psString = session.addToStringPlotList(regs.eax, regs.bx, regs.dx, regs.si, X86Pointer<const int8_t>(regs.edi), _stringColour);
+        if (psString != nullptr)
+        {
+            // Vanilla copies all of the argument registers
+            const int32_t args[2] = { regs.ecx, regs.edi };
+            std::memcpy(&psString->args[2], args, sizeof(args));
+            psString->args[6] = 0;
+        }
+        return psString;
+    }
+
+    static World::Pos3 getHookOffset(const registers& regs)
+    {
+        return World::Pos3(static_cast<int8_t>(regs.al), static_cast<int8_t>(regs.cl), regs.dx);
+    }
+
+    static World::Pos3 getHookBoundBoxSize(const registers& regs)
+    {
+        return World::Pos3(regs.di, regs.si, static_cast<int8_t>(regs.ah));
+    }
+
+    static PaintStruct* addToPlotListAsParentHookHelper(registers& regs, uint8_t rotation)
+    {
+        PaintSession session;
+        session.setRotation(rotation);
+        return session.addToPlotListAsParent(ImageId::fromUInt32(regs.ebx), getHookOffset(regs), getHookBoundBoxSize(regs));
+    }
+
+    static PaintStruct* addToPlotListAsParentWithBoundBoxHookHelper(registers& regs, uint8_t rotation)
+    {
+        PaintSession session;
+        session.setRotation(rotation);
+        return session.addToPlotListAsParent(ImageId::fromUInt32(regs.ebx), getHookOffset(regs), session.getBoundingBoxOffset(), getHookBoundBoxSize(regs));
+    }
+
+    static PaintStruct* addToPlotListAsChildHookHelper(registers& regs, uint8_t rotation)
+    {
+        PaintSession session;
+        session.setRotation(rotation);
+        return session.addToPlotListAsChild(ImageId::fromUInt32(regs.ebx), getHookOffset(regs), session.getBoundingBoxOffset(), getHookBoundBoxSize(regs));
+    }
+
+    static PaintStruct* addToPlotList4FD200HookHelper(registers& regs, uint8_t rotation)
+    {
+        PaintSession session;
+        session.setRotation(rotation);
+        return session.addToPlotList4FD200(ImageId::fromUInt32(regs.ebx), getHookOffset(regs), session.getBoundingBoxOffset(), getHookBoundBoxSize(regs));
+    }
+
+    // The tables of 0x004FD120, 0x004FD130, 0x004FD140, 0x004FD1E0 and 0x004FD200 for each rotation. Tile
+    // elements still painted by vanilla (e.g. surfaces and roads) add their paint structs through these.
+    static constexpr uint32_t kAddToStringPlotList[] = { 0x0045A3EB, 0x0045A474, 0x0045A4FD, 0x0045A586 };
+    static constexpr uint32_t kAddToPlotListAsParent[] = { 0x0045A711, 0x0045A892, 0x0045AA21, 0x0045ABB2 };
+    static constexpr uint32_t kAddToPlotListAsParentWithBoundBox[] = { 0x0045AD43, 0x0045AEE5, 0x0045B098, 0x0045B250 };
+    static constexpr uint32_t kAddToPlotListAsChild[] = { 0x0045D367, 0x0045D4CF, 0x0045D643, 0x0045D7B9 };
+    static constexpr uint32_t kAddToPlotList4FD200[] = { 0x0045E01D, 0x0045E1E4, 0x0045E3C2, 0x0045E59F };
+
+    template<uint8_t rotation>
+    FORCE_ALIGN_ARG_POINTER static uint8_t addToStringPlotListHook(registers& regs)
+    {
+        registers backup = regs;
+
+        auto* psString = addToStringPlotListHookHelper(regs, rotation);
+        regs = backup;
+        regs.ebp = X86Pointer(psString);
+        return 0;
+    }
+
+    template<PaintStruct* (*helper)(registers&, uint8_t), uint8_t rotation>
+    FORCE_ALIGN_ARG_POINTER static uint8_t addToPlotListHook(registers& regs)
+    {
+        registers backup = regs;
+
+        auto* ps = helper(regs, rotation);
+        regs = backup;
+        regs.ebp = X86Pointer(ps);
+        return ps == nullptr ? X86_FLAG_CARRY : 0;
+    }
+
+    template<uint8_t rotation>
+    static void registerPlotListHooks()
+    {
+        registerHook(kAddToStringPlotList[rotation], addToStringPlotListHook<rotation>);
+        registerHook(kAddToPlotListAsParent[rotation], addToPlotListHook<addToPlotListAsParentHookHelper, rotation>);
+        registerHook(kAddToPlotListAsParentWithBoundBox[rotation], addToPlotListHook<addToPlotListAsParentWithBoundBoxHookHelper, rotation>);
+        registerHook(kAddToPlotListAsChild[rotation], addToPlotListHook<addToPlotListAsChildHookHelper, rotation>);
+        registerHook(kAddToPlotList4FD200[rotation], addToPlotListHook<addToPlotList4FD200HookHelper, rotation>);
+    }
+
     void registerHooks()
     {
+        registerPlotListHooks<0>();
+        registerPlotListHooks<1>();
+        registerPlotListHooks<2>();
+        registerPlotListHooks<3>();
+
         registerHook(
             0x004622A2,
             [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
@@ -641,37 +853,302 @@ namespace OpenLoco::Paint
         return { mapLoc, numVerticalQuadrants, additionalQuadrants, nextVerticalQuadrant };
     }
 
-    void PaintSession::generateTilesAndEntities(GenerationParameters&& p)
+    void PaintSession::generateTilesAndEntities(const GenerationParameters& p)
     {
-        for (; p.numVerticalQuadrants > 0; --p.numVerticalQuadrants)
+        auto mapLoc = p.mapLoc;
+        for (auto i = p.numVerticalQuadrants; i > 0; --i)
         {
-            paintTileElements(*this, p.mapLoc);
-            paintEntities(*this, p.mapLoc);
+            paintTileElements(*this, mapLoc);
+            paintEntities(*this, mapLoc);
 
-            auto loc1 = p.mapLoc + p.additionalQuadrants[0];
+            auto loc1 = mapLoc + p.additionalQuadrants[0];
             paintTileElements2(*this, loc1);
             paintEntities(*this, loc1);
 
-            auto loc2 = p.mapLoc + p.additionalQuadrants[1];
+            auto loc2 = mapLoc + p.additionalQuadrants[1];
             paintTileElements(*this, loc2);
             paintEntities(*this, loc2);
 
-            auto loc3 = p.mapLoc + p.additionalQuadrants[2];
+            auto loc3 = mapLoc + p.additionalQuadrants[2];
             paintTileElements2(*this, loc3);
             paintEntities(*this, loc3);
 
-            auto loc4 = p.mapLoc + p.additionalQuadrants[3];
+            auto loc4 = mapLoc + p.additionalQuadrants[3];
             paintEntities2(*this, loc4);
 
-            auto loc5 = p.mapLoc + p.additionalQuadrants[4];
+            auto loc5 = mapLoc + p.additionalQuadrants[4];
             paintEntities2(*this, loc5);
 
-            p.mapLoc += p.nextVerticalQuadrant;
+            mapLoc += p.nextVerticalQuadrant;
+        }
+    }
+
+    // Returns false if the location added to the quadrants or strings without going through
+    // addPSToQuadrant or attachStringStruct, i.e. vanilla code linked them in directly.
+    bool PaintSession::endStaticLayerLocation()
+    {
+        if (_quadrantBackIndex != std::numeric_limits<uint32_t>::max() || _paintStringHead != nullptr)
+        {
+            return false;
+        }
+
+        _staticLayerInsertions.locations.push_back(StaticLayerLocation{
+            static_cast<uint32_t>(_staticLayerInsertions.quadrantEntries.size()),
+            static_cast<uint32_t>(_staticLayerInsertions.strings.size()),
+            _lastPS,
+        });
+        return true;
+    }
+
+    // Returns false if the static layer could not be recorded, the session must then be reset
+    bool PaintSession::generateTiles(const GenerationParameters& p)
+    {
+        _staticLayerInsertions.quadrantEntries.clear();
+        _staticLayerInsertions.strings.clear();
+        _staticLayerInsertions.locations.clear();
+        _isGeneratingStaticLayer = true;
+
+        bool recorded = true;
+        auto mapLoc = p.mapLoc;
+        for (auto i = p.numVerticalQuadrants; i > 0 && recorded; --i)
+        {
+            paintTileElements(*this, mapLoc);
+            recorded &= endStaticLayerLocation();
+            paintTileElements2(*this, mapLoc + p.additionalQuadrants[0]);
+            recorded &= endStaticLayerLocation();
+            paintTileElements(*this, mapLoc + p.additionalQuadrants[1]);
+            recorded &= endStaticLayerLocation();
+            paintTileElements2(*this, mapLoc + p.additionalQuadrants[2]);
+            recorded &= endStaticLayerLocation();
+
+            mapLoc += p.nextVerticalQuadrant;
+        }
+
+        _isGeneratingStaticLayer = false;
+        return recorded;
+    }
+
+    // Adds what the tile elements of a location painted as if they had been painted just now
+    void PaintSession::placeStaticLayerLocation(size_t index)
+    {
+        const auto& insertions = _staticLayerInsertions;
+        const auto& location = insertions.locations[index];
+        const auto quadrantEntriesBegin = index == 0 ? 0 : insertions.locations[index - 1].quadrantEntriesEnd;
+        const auto stringsBegin = index == 0 ? 0 : insertions.locations[index - 1].stringsEnd;
+
+        for (auto i = quadrantEntriesBegin; i < location.quadrantEntriesEnd; ++i)
+        {
+            linkToQuadrant(*insertions.quadrantEntries[i]);
+        }
+        for (auto i = stringsBegin; i < location.stringsEnd; ++i)
+        {
+            attachStringStruct(*insertions.strings[i]);
         }
+        _lastPS = location.lastPS;
+    }
+
+    // Paints the entities of each location straight after the tile elements of that location are
+    // placed, so the quadrants hold everything in the order vanilla painted it (0x004622A2).
+    void PaintSession::generateEntities(const GenerationParameters& p)
+    {
+        size_t location = 0;
+        auto mapLoc = p.mapLoc;
+        for (auto i = p.numVerticalQuadrants; i > 0; --i)
+        {
+            placeStaticLayerLocation(location++);
+            paintEntities(*this, mapLoc);
+            placeStaticLayerLocation(location++);
+            paintEntities(*this, mapLoc + p.additionalQuadrants[0]);
+            placeStaticLayerLocation(location++);
+            paintEntities(*this, mapLoc + p.additionalQuadrants[1]);
+            placeStaticLayerLocation(location++);
+            paintEntities(*this, mapLoc + p.additionalQuadrants[2]);
+            paintEntities2(*this, mapLoc + p.additionalQuadrants[3]);
+            paintEntities2(*this, mapLoc + p.additionalQuadrants[4]);
+
+            mapLoc += p.nextVerticalQuadrant;
+        }
+    }
+
+    // The static layer of a column is everything painted by the tile elements. It is stored as a
+    // copy of the paint struct arena (and what each location added) straight after the tiles have been
+    // generated. As the arena lives at a fixed address the pointers within the copy remain valid when restored.
+    struct StaticLayerKey
+    {
+        int16_t x;
+        int16_t y;
+        int16_t width;
+        int16_t height;
+        uint16_t zoomLevel;
+        uint8_t rotation;
+        Ui::ViewportFlags viewFlags;
+        World::MapSelectionFlags selectionFlags;
+        World::MapSelectionType selectionCorner;
+        World::Pos2 selectionA;
+        World::Pos2 selectionB;
+        World::Pos3 constructionArrowPos;
+        uint8_t constructionArrowDirection;
+
+        bool operator==(const StaticLayerKey&) const = default;
+    };
+
+    struct StaticLayerEntry
+    {
+        StaticLayerKey key;
+        uint32_t generation;
+        uint32_t modificationStamp;
+        std::optional<uint32_t> ticks; // Only set if the layer contains animated elements
+        std::vector<std::byte> paintEntries;
+        StaticLayerInsertions insertions;
+    };
+
+    static constexpr size_t kMaxStaticLayers = 128;
+    static std::vector<StaticLayerEntry> _staticLayers;
+    static size_t _nextStaticLayerSlot = 0;
+    static uint32_t _staticLayerGeneration = 0;
+
+    // The stamp of the last modification of each tile, compared against the stamp a static layer was saved at
+    static std::array<uint32_t, World::kMapSize> _tileModificationStamps{};
+    static uint32_t _tileModificationStamp = 0;
+
+    void invalidateStaticLayerCache()
+    {
+        _staticLayerGeneration++;
+    }
+
+    void markTileModified(const World::Pos2& pos)
+    {
+        if (!World::validCoords(pos))
+        {
+            return;
+        }
+
+        _tileModificationStamp++;
+        if (_tileModificationStamp == 0)
+        {
+            // Wrapped around, stamps are no longer comparable
+            _tileModificationStamps.fill(0);
+            _tileModificationStamp = 1;
+            invalidateStaticLayerCache();
+        }
+
+        const auto tilePos = World::toTileSpace(pos);
+        _tileModificationStamps[tilePos.y * World::kMapColumns + tilePos.x] = _tileModificationStamp;
+    }
+
+    static StaticLayerKey getStaticLayerKey(const Gfx::RenderTarget& rt, uint8_t rotation, Ui::ViewportFlags viewFlags)
+    {
+        static loco_global<World::Pos3, 0x00F24942> _constructionArrowLocation;
+        static loco_global<uint8_t, 0x00F24948> _constructionArrowDirection;
+
+        const auto [selectionA, selectionB] = World::getMapSelectionArea();
+        return StaticLayerKey{
+            rt.x,
+            rt.y,
+            rt.width,
+            rt.height,
+            rt.zoomLevel,
+            rotation,
+            viewFlags,
+            World::getMapSelectionFlags(),
+            World::getMapSelectionCorner(),
+            selectionA,
+            selectionB,
+            _constructionArrowLocation,
+            _constructionArrowDirection,
+        };
+    }
+
+    // Checks none of the tiles the column paints (or their neighbours as surfaces depend on them) have
+    // been modified since the static layer was saved. Every visible change to a tile invalidates it in
+    // the viewports which marks it as modified.
+    static bool isStaticLayerUnmodified(const GenerationParameters& p, uint32_t modificationStamp)
+    {
+        auto mapLoc = p.mapLoc;
+        for (auto i = p.numVerticalQuadrants; i > 0; --i)
+        {
+            for (const auto& offset : { World::Pos2{ 0, 0 }, p.additionalQuadrants[0], p.additionalQuadrants[1], p.additionalQuadrants[2] })
+            {
+                const auto loc = mapLoc + offset;
+                for (const auto& neighbour : { World::Pos2{ 0, 0 }, World::Pos2{ 32, 0 }, World::Pos2{ -32, 0 }, World::Pos2{ 0, 32 }, World::Pos2{ 0, -32 } })
+                {
+                    const auto tileLoc = loc + neighbour;
+                    if (!World::validCoords(tileLoc))
+                    {
+                        continue;
+                    }
+                    const auto tilePos = World::toTileSpace(tileLoc);
+                    if (_tileModificationStamps[tilePos.y * World::kMapColumns + tilePos.x] > modificationStamp)
+                    {
+                        return false;
+                    }
+                }
+            }
+            mapLoc += p.nextVerticalQuadrant;
+        }
+        return true;
+    }
+
+    bool PaintSession::tryRestoreStaticLayer(const GenerationParameters& p)
+    {
+        const auto key = getStaticLayerKey(**_renderTarget, currentRotation, _viewFlags);
+        auto it = std::find_if(_staticLayers.begin(), _staticLayers.end(), [&key](const StaticLayerEntry& entry) {
+            return entry.key == key && entry.generation == _staticLayerGeneration;
+        });
+        if (it == _staticLayers.end())
+        {
+            return false;
+        }
+        if (it->ticks.has_value() && *it->ticks != ScenarioManager::getScenarioTicks())
+        {
+            return false;
+        }
+        if (!isStaticLayerUnmodified(p, it->modificationStamp))
+        {
+            return false;
+        }
+
+        std::memcpy(&_paintEntries[0], it->paintEntries.data(), it->paintEntries.size());
+        _nextFreePaintStruct = reinterpret_cast<PaintEntry*>(reinterpret_cast<std::byte*>(&_paintEntries[0]) + it->paintEntries.size());
+        _staticLayerInsertions = it->insertions;
+        return true;
+    }
+
+    void PaintSession::saveStaticLayer()
+    {
+        if (_staticLayers.size() < kMaxStaticLayers)
+        {
+            _staticLayers.emplace_back();
+            _nextStaticLayerSlot = _staticLayers.size() - 1;
+        }
+        auto& entry = _staticLayers[_nextStaticLayerSlot];
+        _nextStaticLayerSlot = (_nextStaticLayerSlot + 1) % kMaxStaticLayers;
+
+        entry.key = getStaticLayerKey(**_renderTarget, currentRotation, _viewFlags);
+        entry.generation = _staticLayerGeneration;
+        entry.modificationStamp = _tileModificationStamp;
+        entry.ticks = _staticLayerUsesTicks ? std::make_optional(ScenarioManager::getScenarioTicks()) : std::nullopt;
+
+        const auto* arenaBegin = reinterpret_cast<const std::byte*>(&_paintEntries[0]);
+        const auto* arenaEnd = reinterpret_cast<const std::byte*>(*_nextFreePaintStruct);
+        entry.paintEntries.assign(arenaBegin, arenaEnd);
+        entry.insertions = _staticLayerInsertions;
+    }
+
+    uint32_t PaintSession::getScenarioTicks()
+    {
+        _staticLayerUsesTicks = true;
+        return ScenarioManager::getScenarioTicks();
     }
 
     void PaintSession::attachStringStruct(PaintStringStruct& psString)
     {
+        if (_isGeneratingStaticLayer)
+        {
+            _staticLayerInsertions.strings.push_back(&psString);
+            return;
+        }
+
         auto* previous = *_lastPaintString;
         _lastPaintString = &psString;
         if (previous == nullptr)
@@ -734,25 +1211,49 @@ namespace OpenLoco::Paint
     // 0x004622A2
     void PaintSession::generate()
     {
+        OPENLOCO_PROFILE_SCOPE("PaintSession::generate");
+
         if (!Game::hasFlags(GameStateFlags::tileManagerLoaded))
             return;
 
         currentRotation = Ui::WindowManager::getCurrentRotation();
+        GenerationParameters p{};
         switch (currentRotation)
         {
             case 0:
-                generateTilesAndEntities(generateParameters<0>(getRenderTarget()));
+                p = generateParameters<0>(getRenderTarget());
                 break;
             case 1:
-                generateTilesAndEntities(generateParameters<1>(getRenderTarget()));
+                p = generateParameters<1>(getRenderTarget());
                 break;
             case 2:
-                generateTilesAndEntities(generateParameters<2>(getRenderTarget()));
+                p = generateParameters<2>(getRenderTarget());
                 break;
             case 3:
-                generateTilesAndEntities(generateParameters<3>(getRenderTarget()));
+                p = generateParameters<3>(getRenderTarget());
                 break;
         }
+
+        if (!_cacheStaticLayer)
+        {
+            generateTilesAndEntities(p);
+            return;
+        }
+
+        // The tiles are generated first so their paint structs can be reused between frames,
+        // generateEntities then restores the interleaving of tiles and entities per location.
+        if (!tryRestoreStaticLayer(p))
+        {
+            if (!generateTiles(p))
+            {
+                // Something painted by vanilla bypassed the recording so the column can't be cached
+                resetPaintStructs();
+                generateTilesAndEntities(p);
+                return;
+            }
+            saveStaticLayer();
+        }
+        generateEntities(p);
     }
 
     template<uint8_t>
@@ -928,6 +1429,8 @@ namespace OpenLoco::Paint
     // 0x0045E7B5
     void PaintSession::arrangeStructs()
     {
+        OPENLOCO_PROFILE_SCOPE("PaintSession::arrangeStructs");
+
         _paintHead = _nextFreePaintStruct;
         _nextFreePaintStruct++;
 
@@ -1151,11 +1654,22 @@ namespace OpenLoco::Paint
     // 0x0045EA23
     void PaintSession::drawStructs()
     {
+        OPENLOCO_PROFILE_SCOPE("PaintSession::drawStructs");
+
         Gfx::RenderTarget& rt = **_renderTarget;
         auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
 
+        // Picks are recorded before culling and at the hit test positions so the pick buffer
+        // returns the same items as getNormalInteractionInfo.
+        const bool recordPicks = PickBuffer::isRecording();
+
         for (const auto* ps = (*_paintHead)->basic.nextQuadrantPS; ps != nullptr; ps = ps->nextQuadrantPS)
         {
+            if (recordPicks)
+            {
+                PickBuffer::write(rt, ps->vpPos, ps->imageId, InteractionArg(*ps));
+            }
+
             const bool shouldCull = shouldTryCullPaintStruct(*ps, _viewFlags);
 
             if (shouldCull)
@@ -1172,6 +1686,11 @@ namespace OpenLoco::Paint
             for (const auto* childPs = ps->children; childPs != nullptr; childPs = childPs->children)
             {
                 // assert(childPs->attachedPS == nullptr); Children can have attachments but we are skipping them to be investigated!
+                if (recordPicks)
+                {
+                    PickBuffer::write(rt, childPs->vpPos, childPs->imageId, InteractionArg(*childPs));
+                }
+
                 const bool shouldCullChild = shouldTryCullPaintStruct(*childPs, _viewFlags);
 
                 if (shouldCullChild)
@@ -1188,6 +1707,11 @@ namespace OpenLoco::Paint
             // Draw any attachments to the struct
             for (const auto* attachPs = ps->attachedPS; attachPs != nullptr; attachPs = attachPs->next)
             {
+                if (recordPicks)
+                {
+                    PickBuffer::write(rt, ps->vpPos + attachPs->vpPos, attachPs->imageId, InteractionArg(*ps));
+                }
+
                 const bool shouldCullAttach = shouldTryCullPaintStruct(*ps, _viewFlags);
                 if (shouldCullAttach)
                 {
@@ -1275,7 +1799,7 @@ namespace OpenLoco::Paint
     }
 
     // 0x0045EDFC
-    static bool isPSSpriteTypeInFilter(const InteractionItem spriteType, InteractionItemFlags filter)
+    bool isPSSpriteTypeInFilter(const InteractionItem spriteType, InteractionItemFlags filter)
     {
         constexpr InteractionItemFlags interactionItemToFilter[] = {
             InteractionItemFlags::none,
@@ -199,6 +199,7 @@ namespace OpenLoco::Paint
         uint8_t rotation;
         int16_t foregroundCullHeight;
         Ui::ViewportFlags viewFlags;
+        bool cacheStaticLayer; // Reuse tile element paint structs from previous frames (see PaintSession::generate)
         constexpr bool hasFlags(Ui::ViewportFlags flagsToTest) const
         {
             return (viewFlags & flagsToTest) != Ui::ViewportFlags::none;
@@ -220,6 +221,8 @@ namespace OpenLoco::Paint
         [[nodiscard]] Ui::ViewportInteraction::InteractionArg getTownNameInteractionInfo(const Ui::ViewportInteraction::InteractionItemFlags flags);
         Gfx::RenderTarget* getRenderTarget() { return _renderTarget; }
         uint8_t getRotation() { return currentRotation; }
+        // Use instead of ScenarioManager::getScenarioTicks so that the static layer cache knows the output is animated
+        uint32_t getScenarioTicks();
         void setRotation(uint8_t rotation) { currentRotation = rotation; }
         int16_t getMaxHeight() { return _maxHeight; }
         uint32_t get112C300() { return _112C300; }
@@ -370,7 +373,7 @@ namespace OpenLoco::Paint
          * @param boundBoxOffsetY @<0xE3F0A2>
          * @param boundBoxOffsetZ @<0xE3F0A4>
          */
-        void addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
+        PaintStruct* addToPlotList4FD200(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
         /*
          * @param imageId @<ebx>
          * @param offsetX @<ax>
@@ -379,7 +382,14 @@ namespace OpenLoco::Paint
         AttachedPaintStruct* attachToPrevious(ImageId imageId, const Ui::Point& offset);
 
     private:
-        void generateTilesAndEntities(GenerationParameters&& p);
+        void resetPaintStructs();
+        void generateTilesAndEntities(const GenerationParameters& p);
+        bool endStaticLayerLocation();
+        bool generateTiles(const GenerationParameters& p);
+        void generateEntities(const GenerationParameters& p);
+        void placeStaticLayerLocation(size_t index);
+        bool tryRestoreStaticLayer(const GenerationParameters& p);
+        void saveStaticLayer();
         void finaliseOrdering(std::span<PaintStruct*> paintStructs);
 
         inline static Interop::loco_global<Gfx::RenderTarget*, 0x00E0C3E0> _renderTarget;
@@ -403,6 +413,8 @@ namespace OpenLoco::Paint
         inline static Interop::loco_global<World::Pos2, 0x00E3F0B0> _mapPosition;
         inline static Interop::loco_global<void*, 0x00E3F0B4> _currentItem;
         uint8_t currentRotation; // new field set from 0x00E3F0B8 but split out into this struct as separate item
+        bool _cacheStaticLayer;
+        bool _staticLayerUsesTicks;
         inline static Interop::loco_global<Ui::ViewportFlags, 0x00E3F0BC> _viewFlags;
         // 2 byte align.
         inline static Interop::loco_global<PaintStruct* [kMaxPaintQuadrants], 0x00E3F0C0> _quadrants;
@@ -478,10 +490,18 @@ namespace OpenLoco::Paint
         }
         void attachStringStruct(PaintStringStruct& psString);
         void addPSToQuadrant(PaintStruct& ps);
+        void linkToQuadrant(PaintStruct& ps);
         PaintStruct* createNormalPaintStruct(ImageId imageId, const World::Pos3& offset, const World::Pos3& boundBoxOffset, const World::Pos3& boundBoxSize);
     };
 
     PaintSession* allocateSession(Gfx::RenderTarget& rt, const SessionOptions& options);
 
+    // Drops all cached static layers, used when state not covered by the cache key changes (e.g. object reload)
+    void invalidateStaticLayerCache();
+    // Drops the cached static layers that paint the tile, called whenever the tile is invalidated in the viewports
+    void markTileModified(const World::Pos2& pos);
+
+    bool isPSSpriteTypeInFilter(const Ui::ViewportInteraction::InteractionItem spriteType, Ui::ViewportInteraction::InteractionItemFlags filter);
+
     void registerHooks();
 }
@@ -5,7 +5,6 @@
 #include "Objects/ObjectManager.h"
 #include "Objects/ScaffoldingObject.h"
 #include "Paint.h"
-#include "ScenarioManager.h"
 #include "Ui/ViewportInteraction.h"
 
 namespace OpenLoco::Paint
@@ -20,7 +19,7 @@ namespace OpenLoco::Paint
     static void paintBuildingBuilding(PaintSession& session, const World::BuildingElement& elBuilding, const BuildingObject& buildingObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation, const bool isMultiTile)
     {
         // 0xE0C3A0
-        auto ticks = ScenarioManager::getScenarioTicks();
+        auto ticks = session.getScenarioTicks();
         uint8_t numSections = 0xF0; // 0xF0 represents all sections completed
         // Only used when under construction
         uint8_t sectionProgress = 0;
@@ -140,7 +139,7 @@ namespace OpenLoco::Paint
             for (auto animIdx = 0; animIdx < buildingObj.numElevatorSequences; ++animIdx)
             {
                 auto sequence = buildingObj.getElevatorHeightSequence(animIdx);
-                auto tickThing = ScenarioManager::getScenarioTicks() / 2;
+                auto tickThing = session.getScenarioTicks() / 2;
                 auto pos = World::toTileSpace(session.getUnkPosition());
                 tickThing += pos.x * 8;
                 tickThing += pos.y * 8;
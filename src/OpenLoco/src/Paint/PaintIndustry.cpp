@@ -4,7 +4,6 @@
 #include "Objects/ObjectManager.h"
 #include "Objects/ScaffoldingObject.h"
 #include "Paint.h"
-#include "ScenarioManager.h"
 #include "Ui.h"
 #include "Ui/ViewportInteraction.h"
 #include "World/Industry.h"
@@ -21,7 +20,7 @@ namespace OpenLoco::Paint
     static void paintIndustryBuilding(PaintSession& session, const World::IndustryElement& elIndustry, const IndustryObject& indObj, const World::Pos3& imageOffset, const World::Pos3& bbOffset, const World::Pos3& bbSize, const ImageId& baseColour, const uint8_t rotation, const bool isMultiTile)
     {
         // 0xE0C3A0
-        auto ticks = ScenarioManager::getScenarioTicks();
+        auto ticks = session.getScenarioTicks();
         uint8_t numSections = 0xF0; // 0xF0 represents all sections completed
         // Only used when under construction
         uint8_t sectionProgress = 0;
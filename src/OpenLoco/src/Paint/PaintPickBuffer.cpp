@@ -0,0 +1,397 @@
+#include "PaintPickBuffer.h"
+#include "Config.h"
+#include "Drawing/SoftwareDrawingEngine.h"
+#include "Entities/Entity.h"
+#include "Entities/EntityManager.h"
+#include "Graphics/Colour.h"
+#include "Graphics/Gfx.h"
+#include "Graphics/PaletteMap.h"
+#include "Map/TileManager.h"
+#include "Paint.h"
+#include "Viewport.hpp"
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+using namespace OpenLoco::Ui::ViewportInteraction;
+
+namespace OpenLoco::Paint::PickBuffer
+{
+    // Ids are stored as two bytes in separate planes (each 1-255) as sprites can only be drawn
+    // to 8 bit targets. Zero in either plane means nothing was recorded at the pixel.
+    static constexpr uint32_t kIdsPerPlane = 255;
+    static constexpr uint32_t kMaxEntries = kIdsPerPlane * kIdsPerPlane;
+
+    struct PickKey
+    {
+        const void* object;
+        const Ui::Viewport* viewport;
+        World::Pos2 pos;
+        InteractionItem type;
+        uint8_t modId;
+
+        bool operator==(const PickKey&) const = default;
+    };
+
+    struct PickKeyHash
+    {
+        size_t operator()(const PickKey& key) const
+        {
+            auto hash = std::hash<const void*>{}(key.object);
+            hash = hash * 31 + std::hash<const void*>{}(key.viewport);
+            hash = hash * 31 + static_cast<uint16_t>(key.pos.x);
+            hash = hash * 31 + static_cast<uint16_t>(key.pos.y);
+            hash = hash * 31 + ((enumValue(key.type) << 8) | key.modId);
+            return hash;
+        }
+    };
+
+    struct PickEntry
+    {
+        InteractionArg arg;
+        const Ui::Viewport* viewport;
+        // Copy of the tile element when drawn, detects elements that were removed or replaced
+        std::array<uint8_t, World::kTileElementSize> element;
+    };
+
+    static std::array<std::vector<uint8_t>, 2> _planes;
+    static const uint8_t* _screenBits = nullptr;
+    static int32_t _screenStride = 0;
+    static int32_t _screenHeight = 0;
+
+    static std::vector<PickEntry> _entries;
+    static std::unordered_map<PickKey, uint32_t, PickKeyHash> _entryIds;
+
+    static const Ui::Viewport* _recordingViewport = nullptr;
+    static const Gfx::RenderTarget* _target = nullptr;
+
+    static const Gfx::RenderTarget& getTarget()
+    {
+        return _target != nullptr ? *_target : Gfx::getScreenRT();
+    }
+
+    bool isEnabled()
+    {
+        return _target != nullptr || Config::get().pickBuffer;
+    }
+
+    void setTarget(const Gfx::RenderTarget* target)
+    {
+        _target = target;
+
+        // Forget the previous target, the planes are set up for the new one on the next region
+        _screenBits = nullptr;
+        _screenStride = 0;
+        _screenHeight = 0;
+        for (auto& plane : _planes)
+        {
+            plane = {};
+        }
+        _entries.clear();
+        _entryIds.clear();
+    }
+
+    static bool isTileElement(const void* object)
+    {
+        const auto elements = World::TileManager::getElements();
+        const auto address = reinterpret_cast<uintptr_t>(object);
+        const auto begin = reinterpret_cast<uintptr_t>(elements.data());
+        const auto end = reinterpret_cast<uintptr_t>(elements.data() + elements.size());
+        return address >= begin && address < end;
+    }
+
+    static void clearEntries()
+    {
+        _entries.clear();
+        _entryIds.clear();
+        for (auto& plane : _planes)
+        {
+            std::fill(plane.begin(), plane.end(), 0);
+        }
+    }
+
+    // Keeps the planes the same size as the screen (or target), everything is cleared when it changes.
+    static void syncWithScreen()
+    {
+        const auto& screen = getTarget();
+        const auto stride = screen.width + screen.pitch;
+        if (screen.bits == _screenBits && stride == _screenStride && screen.height == _screenHeight)
+        {
+            return;
+        }
+
+        _screenBits = screen.bits;
+        _screenStride = stride;
+        _screenHeight = screen.height;
+        for (auto& plane : _planes)
+        {
+            plane.assign(static_cast<size_t>(stride) * screen.height, 0);
+        }
+        _entries.clear();
+        _entryIds.clear();
+    }
+
+    // Returns the byte offset of rt within the screen or nullopt if any of it lies outside.
+    static std::optional<size_t> getScreenOffset(const Gfx::RenderTarget& rt)
+    {
+        if (_screenBits == nullptr || rt.bits < _screenBits)
+        {
+            return std::nullopt;
+        }
+
+        const auto offset = static_cast<size_t>(rt.bits - _screenBits);
+        const auto rows = rt.height >> rt.zoomLevel;
+        const auto columns = rt.width >> rt.zoomLevel;
+        const auto stride = columns + rt.pitch;
+        const auto lastPixel = offset + static_cast<size_t>(std::max(rows - 1, 0)) * stride + columns;
+        if (lastPixel > _planes[0].size())
+        {
+            return std::nullopt;
+        }
+        return offset;
+    }
+
+    static Gfx::RenderTarget getPlaneRenderTarget(const Gfx::RenderTarget& rt, size_t plane, size_t offset)
+    {
+        auto planeRt = rt;
+        planeRt.bits = _planes[plane].data() + offset;
+        return planeRt;
+    }
+
+    bool beginRegion(const Gfx::RenderTarget& rt, const Ui::Viewport& viewport)
+    {
+        if (!isEnabled())
+        {
+            _recordingViewport = nullptr;
+            return false;
+        }
+
+        syncWithScreen();
+
+        const auto offset = getScreenOffset(rt);
+        if (!offset.has_value())
+        {
+            _recordingViewport = nullptr;
+            return false;
+        }
+
+        auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
+        for (size_t plane = 0; plane < _planes.size(); ++plane)
+        {
+            auto planeRt = getPlaneRenderTarget(rt, plane, *offset);
+            drawingCtx.clearSingle(planeRt, 0);
+        }
+
+        _recordingViewport = &viewport;
+        return true;
+    }
+
+    void endRegion()
+    {
+        _recordingViewport = nullptr;
+    }
+
+    bool isRecording()
+    {
+        return _recordingViewport != nullptr;
+    }
+
+    static uint32_t getEntryId(const InteractionArg& arg)
+    {
+        const auto key = PickKey{ arg.object, _recordingViewport, arg.pos, arg.type, arg.modId };
+        auto it = _entryIds.find(key);
+        if (it == _entryIds.end())
+        {
+            if (_entries.size() >= kMaxEntries)
+            {
+                // Out of ids, start again and redraw everything so the buffer is filled back in.
+                clearEntries();
+                Gfx::invalidateScreen();
+            }
+            it = _entryIds.emplace(key, static_cast<uint32_t>(_entries.size())).first;
+            _entries.push_back(PickEntry{ arg, _recordingViewport, {} });
+        }
+
+        // Refreshed on every draw so an element that has changed in place is still valid
+        auto& entry = _entries[it->second];
+        if (arg.type != InteractionItem::entity && isTileElement(arg.object))
+        {
+            std::memcpy(entry.element.data(), arg.object, entry.element.size());
+        }
+        return it->second;
+    }
+
+    void write(const Gfx::RenderTarget& rt, const Ui::Point& pos, ImageId image, const InteractionArg& arg)
+    {
+        const auto offset = getScreenOffset(rt);
+        if (!offset.has_value())
+        {
+            return;
+        }
+
+        const auto id = getEntryId(arg);
+        const std::array<uint8_t, 2> values = {
+            static_cast<uint8_t>(id % kIdsPerPlane + 1),
+            static_cast<uint8_t>(id / kIdsPerPlane + 1),
+        };
+
+        // Drawing with a primary colour remaps every opaque pixel through the palette which
+        // here maps them all to the id.
+        auto& drawingCtx = Gfx::getDrawingEngine().getDrawingContext();
+        const auto pickImage = ImageId(image.getIndex(), Colour::black);
+        for (size_t plane = 0; plane < _planes.size(); ++plane)
+        {
+            Gfx::PaletteMap::Buffer<256> palette;
+            palette.fill(values[plane]);
+
+            auto planeRt = getPlaneRenderTarget(rt, plane, *offset);
+            drawingCtx.drawImagePaletteSet(planeRt, pos, pickImage, palette, nullptr);
+        }
+    }
+
+    void moveRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy)
+    {
+        if (_screenBits == nullptr || width <= 0 || height <= 0)
+        {
+            return;
+        }
+
+        for (auto& plane : _planes)
+        {
+            int32_t stride = _screenStride;
+            uint8_t* to = plane.data() + y * stride + x;
+            const uint8_t* from = plane.data() + (y - dy) * stride + x - dx;
+            if (dy > 0)
+            {
+                to += (height - 1) * stride;
+                from += (height - 1) * stride;
+                stride = -stride;
+            }
+            for (int32_t i = 0; i < height; i++)
+            {
+                std::memmove(to, from, width);
+                to += stride;
+                from += stride;
+            }
+        }
+    }
+
+    static bool isEntryValid(const PickEntry& entry)
+    {
+        const auto& arg = entry.arg;
+        if (arg.object == nullptr)
+        {
+            return false;
+        }
+
+        if (arg.type == InteractionItem::entity)
+        {
+            const auto* entity = static_cast<const EntityBase*>(arg.object);
+            return entity->baseType != EntityBaseType::null && EntityManager::get<EntityBase>(entity->id) == entity;
+        }
+
+        if (!isTileElement(arg.object) || !World::validCoords(arg.pos))
+        {
+            return false;
+        }
+        const auto* element = static_cast<const World::TileElement*>(arg.object);
+        const auto tile = World::TileManager::get(arg.pos);
+        if (tile.indexOf(element) == World::Tile::npos)
+        {
+            return false;
+        }
+        return std::memcmp(element, entry.element.data(), entry.element.size()) == 0;
+    }
+
+    std::optional<InteractionArg> get(const Ui::Viewport& viewport, const Ui::Point& screenPos)
+    {
+        if (!isEnabled())
+        {
+            return std::nullopt;
+        }
+
+        const auto& screen = getTarget();
+        if (_screenBits == nullptr || screen.bits != _screenBits || screen.width + screen.pitch != _screenStride || screen.height != _screenHeight)
+        {
+            return std::nullopt;
+        }
+        const auto x = screenPos.x - screen.x;
+        const auto y = screenPos.y - screen.y;
+        if (x < 0 || y < 0 || x >= screen.width || y >= screen.height)
+        {
+            return std::nullopt;
+        }
+
+        const auto index = static_cast<size_t>(y) * _screenStride + x;
+        const auto low = _planes[0][index];
+        const auto high = _planes[1][index];
+        if (low == 0 || high == 0)
+        {
+            return std::nullopt;
+        }
+
+        const auto id = (high - 1) * kIdsPerPlane + (low - 1);
+        if (id >= _entries.size())
+        {
+            return std::nullopt;
+        }
+
+        const auto& entry = _entries[id];
+        if (entry.viewport != &viewport || !isEntryValid(entry))
+        {
+            return std::nullopt;
+        }
+        return entry.arg;
+    }
+
+    uint32_t verify(Ui::Viewport& viewport, int32_t spacing)
+    {
+        std::vector<uint8_t> bits(static_cast<size_t>(viewport.width) * viewport.height);
+        Gfx::RenderTarget rt{};
+        rt.bits = bits.data();
+        rt.x = viewport.x;
+        rt.y = viewport.y;
+        rt.width = viewport.width;
+        rt.height = viewport.height;
+        rt.pitch = 0;
+        rt.zoomLevel = 0;
+
+        setTarget(&rt);
+        viewport.render(&rt);
+
+        const auto flags = ~InteractionItemFlags::none;
+        uint32_t numPoints = 0;
+        uint32_t numMisses = 0;
+        uint32_t numMismatches = 0;
+        for (int32_t y = viewport.y; y < viewport.y + viewport.height; y += spacing)
+        {
+            for (int32_t x = viewport.x; x < viewport.x + viewport.width; x += spacing)
+            {
+                const Ui::Point screenPos = { static_cast<int16_t>(x), static_cast<int16_t>(y) };
+                const auto expected = Ui::ViewportInteraction::hitTest(viewport, screenPos, flags);
+                const auto picked = get(viewport, screenPos);
+                numPoints++;
+
+                // Nothing usable recorded falls back to hit testing, only a different item is wrong
+                if (!picked.has_value() || !isPSSpriteTypeInFilter(picked->type, flags))
+                {
+                    numMisses++;
+                    continue;
+                }
+                if (picked->type != expected.type || picked->object != expected.object || picked->pos != expected.pos || picked->modId != expected.modId)
+                {
+                    numMismatches++;
+                    Logging::warn("Pick buffer at ({}, {}) has item {} at ({}, {}), hit test found {} at ({}, {})", x, y, enumValue(picked->type), picked->pos.x, picked->pos.y, enumValue(expected.type), expected.pos.x, expected.pos.y);
+                }
+            }
+        }
+        setTarget(nullptr);
+
+        Logging::info("Pick buffer checked at {} points, {} fell back to hit testing, {} differed", numPoints, numMisses, numMismatches);
+        return numMismatches;
+    }
+}
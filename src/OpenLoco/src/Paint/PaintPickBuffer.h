@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Graphics/ImageId.h"
+#include "Graphics/RenderTarget.h"
+#include "Ui/ViewportInteraction.h"
+#include <optional>
+
+namespace OpenLoco::Ui
+{
+    struct Viewport;
+}
+
+/**
+ * Screen sized buffer of the interaction item drawn topmost at each pixel of the viewports.
+ * Written as a side effect of drawing so hovering and clicking can read the item under the
+ * cursor instead of generating and hit testing a paint session of the pixel.
+ */
+namespace OpenLoco::Paint::PickBuffer
+{
+    // Only recorded and read with the pickBuffer config setting as it draws every sprite a second
+    // time, or while recording to a target set with setTarget.
+    bool isEnabled();
+
+    // Records to target in place of the screen until reset with nullptr, target must outlive it.
+    void setTarget(const Gfx::RenderTarget* target);
+
+    // Starts recording the items drawn to the region of the screen covered by rt, clearing what
+    // was recorded there before. Returns false if rt is not part of the screen.
+    bool beginRegion(const Gfx::RenderTarget& rt, const Ui::Viewport& viewport);
+    void endRegion();
+    bool isRecording();
+
+    // Records arg at the opaque pixels of image, uses the same positions as paint session hit testing.
+    void write(const Gfx::RenderTarget& rt, const Ui::Point& pos, ImageId image, const Ui::ViewportInteraction::InteractionArg& arg);
+
+    // Mirrors a move of an already clipped block of the screen (see WindowManager copyRect).
+    void moveRect(int32_t x, int32_t y, int32_t width, int32_t height, int32_t dx, int32_t dy);
+
+    // Item recorded at screenPos if it was drawn by viewport and still exists.
+    std::optional<Ui::ViewportInteraction::InteractionArg> get(const Ui::Viewport& viewport, const Ui::Point& screenPos);
+
+    // Renders viewport to its own target and compares the item recorded at every spacing pixels
+    // with hitTest of the same pixel, returns the number of points that differ.
+    uint32_t verify(Ui::Viewport& viewport, int32_t spacing);
+}
@@ -0,0 +1,218 @@
+#include "PreviewCache.h"
+#include "Environment.h"
+#include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Core/FileStream.h>
+#include <OpenLoco/Core/MemoryStream.h>
+#include <OpenLoco/Diagnostics/Logging.h>
+#include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <cstring>
+#include <deque>
+#include <string>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::S5::PreviewCache
+{
+    static constexpr uint32_t kMagic = 0x43504C4F; // OLPC
+    static constexpr uint32_t kVersion = 1;
+    // A save's details are ~50KB, enough for going back and forth over a folder without growing large
+    static constexpr size_t kMaxEntries = 32;
+
+    enum class PreviewKind : uint8_t
+    {
+        saveDetails,
+        scenarioOptions,
+    };
+
+#pragma pack(push, 1)
+    struct CacheHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t numEntries;
+    };
+
+    struct CacheEntryHeader
+    {
+        PreviewKind kind;
+        uint64_t fileSize;
+        int64_t writeTime;
+        uint32_t pathLength;
+        uint32_t dataLength;
+    };
+#pragma pack(pop)
+
+    struct CacheEntry
+    {
+        PreviewKind kind;
+        std::string path;
+        uint64_t fileSize;
+        int64_t writeTime;
+        // Empty when the file has no preview
+        std::vector<std::byte> data;
+    };
+
+    // Most recently used first
+    static std::deque<CacheEntry> _entries;
+    static bool _isLoaded = false;
+    static bool _isDirty = false;
+
+    static fs::path getCachePath()
+    {
+        return Platform::getUserDirectory() / "cache" / "previews.bin";
+    }
+
+    static void load()
+    {
+        _isLoaded = true;
+
+        const auto cachePath = getCachePath();
+        if (!fs::exists(cachePath))
+        {
+            return;
+        }
+
+        try
+        {
+            FileStream stream(cachePath, StreamMode::read);
+            const auto header = stream.readValue<CacheHeader>();
+            if (header.magic != kMagic || header.version != kVersion)
+            {
+                return;
+            }
+
+            for (uint32_t i = 0; i < std::min<uint32_t>(header.numEntries, kMaxEntries); i++)
+            {
+                const auto entryHeader = stream.readValue<CacheEntryHeader>();
+                if (entryHeader.pathLength + entryHeader.dataLength > stream.getLength() - stream.getPosition())
+                {
+                    throw Exception::RuntimeError("Truncated entry.");
+                }
+
+                CacheEntry entry{ entryHeader.kind, std::string(entryHeader.pathLength, '\0'), entryHeader.fileSize, entryHeader.writeTime, std::vector<std::byte>(entryHeader.dataLength) };
+                stream.read(entry.path.data(), entry.path.size());
+                stream.read(entry.data.data(), entry.data.size());
+                _entries.push_back(std::move(entry));
+            }
+        }
+        catch (const std::exception& e)
+        {
+            Logging::warn("Unable to read the preview cache: {}", e.what());
+            _entries.clear();
+        }
+    }
+
+    void save()
+    {
+        if (!_isDirty)
+        {
+            return;
+        }
+        _isDirty = false;
+
+        const auto cachePath = getCachePath();
+        try
+        {
+            MemoryStream stream;
+            stream.writeValue(CacheHeader{ kMagic, kVersion, static_cast<uint32_t>(_entries.size()) });
+            for (const auto& entry : _entries)
+            {
+                stream.writeValue(CacheEntryHeader{ entry.kind, entry.fileSize, entry.writeTime, static_cast<uint32_t>(entry.path.size()), static_cast<uint32_t>(entry.data.size()) });
+                stream.write(entry.path.data(), entry.path.size());
+                stream.write(entry.data.data(), entry.data.size());
+            }
+
+            Environment::autoCreateDirectory(cachePath.parent_path());
+            FileStream fs(cachePath, StreamMode::write);
+            fs.write(stream.data(), stream.getLength());
+        }
+        catch (const std::exception& e)
+        {
+            Logging::warn("Unable to save the preview cache: {}", e.what());
+        }
+    }
+
+    template<typename T>
+    static std::unique_ptr<T> getPreview(PreviewKind kind, const fs::path& path, std::unique_ptr<T> (*readPreview)(const fs::path&, bool))
+    {
+        if (!_isLoaded)
+        {
+            load();
+        }
+
+        std::error_code ec;
+        const uint64_t fileSize = fs::file_size(path, ec);
+        if (ec)
+        {
+            return nullptr;
+        }
+        const int64_t writeTime = fs::last_write_time(path, ec).time_since_epoch().count();
+        if (ec)
+        {
+            return nullptr;
+        }
+        const auto u8Path = path.u8string();
+
+        auto it = std::find_if(_entries.begin(), _entries.end(), [&](const CacheEntry& entry) {
+            return entry.kind == kind && entry.path == u8Path;
+        });
+        if (it != _entries.end())
+        {
+            auto entry = std::move(*it);
+            _entries.erase(it);
+            if (entry.fileSize == fileSize && entry.writeTime == writeTime && (entry.data.empty() || entry.data.size() == sizeof(T)))
+            {
+                _entries.push_front(std::move(entry));
+                _isDirty = true;
+
+                const auto& data = _entries.front().data;
+                if (data.empty())
+                {
+                    return nullptr;
+                }
+                auto result = std::make_unique<T>();
+                std::memcpy(result.get(), data.data(), sizeof(T));
+                return result;
+            }
+        }
+
+        std::unique_ptr<T> result;
+        try
+        {
+            result = readPreview(path, false);
+        }
+        catch (const std::exception& e)
+        {
+            // Not remembered, it might only be partially written
+            Logging::verbose("Unable to read preview of '{}': {}", path, e.what());
+            return nullptr;
+        }
+
+        CacheEntry entry{ kind, u8Path, fileSize, writeTime, {} };
+        if (result != nullptr)
+        {
+            entry.data.resize(sizeof(T));
+            std::memcpy(entry.data.data(), result.get(), sizeof(T));
+        }
+        _entries.push_front(std::move(entry));
+        if (_entries.size() > kMaxEntries)
+        {
+            _entries.pop_back();
+        }
+        _isDirty = true;
+
+        return result;
+    }
+
+    std::unique_ptr<SaveDetails> getSaveDetails(const fs::path& path)
+    {
+        return getPreview<SaveDetails>(PreviewKind::saveDetails, path, readSaveDetails);
+    }
+
+    std::unique_ptr<Options> getScenarioOptions(const fs::path& path)
+    {
+        return getPreview<Options>(PreviewKind::scenarioOptions, path, readScenarioOptions);
+    }
+}
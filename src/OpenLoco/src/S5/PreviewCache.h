@@ -0,0 +1,19 @@
+#pragma once
+
+#include "S5.h"
+#include <OpenLoco/Core/FileSystem.hpp>
+#include <memory>
+
+/**
+ * Keeps the preview details of the files most recently selected in the file browser, keyed by
+ * path, size and date, so browsing a folder of large saves only decodes each of them once.
+ */
+namespace OpenLoco::S5::PreviewCache
+{
+    // Same results as readSaveDetails and readScenarioOptions without validating the checksum.
+    std::unique_ptr<SaveDetails> getSaveDetails(const fs::path& path);
+    std::unique_ptr<Options> getScenarioOptions(const fs::path& path);
+
+    // Writes the cache to disk if anything was added since it was read.
+    void save();
+}
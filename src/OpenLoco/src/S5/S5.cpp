@@ -21,9 +21,12 @@
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/TrackOccupancy.h"
 #include "ViewportManager.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/IndustryManager.h"
+#include "World/IndustrySurfaces.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Core/Exception.hpp>
@@ -663,6 +666,9 @@ namespace OpenLoco::S5
             }
 
             EntityManager::resetSpatialIndex();
+            Vehicles::TrackOccupancy::invalidate();
+            CompanyOwnership::invalidate();
+            IndustrySurfaces::invalidate();
             CompanyManager::updateColours();
             ObjectManager::sub_4748FA();
             TileManager::resetSurfaceClearance();
@@ -740,11 +746,11 @@ namespace OpenLoco::S5
     }
 
     // 0x00442403
-    std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path)
+    std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path, bool validateChecksum)
     {
         FileStream stream(path, StreamMode::read);
         SawyerStreamReader fs(stream);
-        if (!fs.validateChecksum())
+        if (validateChecksum && !fs.validateChecksum())
         {
             return nullptr;
         }
@@ -775,11 +781,11 @@ namespace OpenLoco::S5
     }
 
     // 0x00442AFC
-    std::unique_ptr<Options> readScenarioOptions(const fs::path& path)
+    std::unique_ptr<Options> readScenarioOptions(const fs::path& path, bool validateChecksum)
     {
         FileStream stream(path, StreamMode::read);
         SawyerStreamReader fs(stream);
-        if (!fs.validateChecksum())
+        if (validateChecksum && !fs.validateChecksum())
         {
             return nullptr;
         }
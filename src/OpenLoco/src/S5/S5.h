@@ -460,8 +460,10 @@ namespace OpenLoco::S5
 
     bool importSaveToGameState(const fs::path& path, LoadFlags flags);
     bool importSaveToGameState(Stream& stream, LoadFlags flags);
-    std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path);
-    std::unique_ptr<Options> readScenarioOptions(const fs::path& path);
+    // Without validating the checksum only the chunks up to the details are decoded, which is all a
+    // preview needs. The file can then still turn out to be corrupt once it is loaded.
+    std::unique_ptr<SaveDetails> readSaveDetails(const fs::path& path, bool validateChecksum = true);
+    std::unique_ptr<Options> readScenarioOptions(const fs::path& path, bool validateChecksum = true);
 
     void sub_4BAEC4();
 }
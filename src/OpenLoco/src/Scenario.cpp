@@ -33,10 +33,13 @@
 #include "Title.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/OrderManager.h"
+#include "Vehicles/TrackOccupancy.h"
 #include "Windows/Construction/Construction.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 #include "World/CompanyRecords.h"
 #include "World/IndustryManager.h"
+#include "World/IndustrySurfaces.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
 #include <OpenLoco/Interop/Interop.hpp>
@@ -207,6 +210,9 @@ namespace OpenLoco::Scenario
         CompanyManager::reset();
         StringManager::reset();
         EntityManager::reset();
+        Vehicles::TrackOccupancy::invalidate();
+        CompanyOwnership::invalidate();
+        IndustrySurfaces::invalidate();
 
         Ui::Windows::Construction::Construction::reset();
         sub_46115C();
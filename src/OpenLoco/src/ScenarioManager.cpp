@@ -23,6 +23,9 @@ using namespace OpenLoco::Interop;
 
 namespace OpenLoco::ScenarioManager
 {
+    // NB: vanilla used 1, 2 adds the size and date of each file to the entries.
+    static constexpr uint8_t kCurrentIndexVersion = 2;
+
 #pragma pack(push, 1)
     struct ScenarioFolderState
     {
@@ -188,8 +191,7 @@ namespace OpenLoco::ScenarioManager
         {
             return false;
         }
-        // version?
-        if ((_scenarioHeader->state.numFiles >> 24) != 1)
+        if ((_scenarioHeader->state.numFiles >> 24) != kCurrentIndexVersion)
         {
             return false;
         }
@@ -222,38 +224,38 @@ namespace OpenLoco::ScenarioManager
     // 0x00444C4E
     static void loadScenarioProgress(ScenarioIndexEntry& entry, S5::Options& options)
     {
-        const auto deliveredCargoObjTempLoaded = ObjectManager::loadTemporaryObject(options.objectiveDeliveredCargo);
         Scenario::Objective objective = options.objective;
         Scenario::ObjectiveProgress progress{};
         progress.timeLimitUntilYear = objective.timeLimitYears + options.scenarioStartYear - 1;
-        if (deliveredCargoObjTempLoaded)
+
+        // Vanilla loaded the scenario's currency in place of the current one, reloading every object
+        // twice per scenario. Only one of the currency or the cargo is ever needed by an objective so
+        // either fits in the temporary object instead.
+        const bool usesCurrency = objective.type == Scenario::ObjectiveType::companyValue || objective.type == Scenario::ObjectiveType::vehicleProfit;
+        if (usesCurrency)
         {
-            objective.deliveredCargoType = 0xFF; // Used to indicate formatChallengeArguments to use tempObj
+            if (ObjectManager::loadTemporaryObject(options.currency))
+            {
+                StringManager::setCurrencyOverride(reinterpret_cast<const CurrencyObject*>(ObjectManager::getTemporaryObject()));
+            }
         }
-        std::optional<ObjectHeader> previousCurrency;
-        if (ObjectManager::get<CurrencyObject>() != nullptr)
+        else if (ObjectManager::loadTemporaryObject(options.objectiveDeliveredCargo))
         {
-            previousCurrency = ObjectManager::getHeader(LoadedObjectHandle{ ObjectType::currency, 0 });
-            ObjectManager::unload(*previousCurrency);
+            objective.deliveredCargoType = 0xFF; // Used to indicate formatChallengeArguments to use tempObj
         }
-        ObjectManager::load(options.currency);
-        ObjectManager::reloadAll();
-        Gfx::loadCurrency();
 
         FormatArguments args{};
         Scenario::formatChallengeArguments(objective, progress, args);
         StringManager::formatString(entry.objective, *reinterpret_cast<const StringId*>(&args), reinterpret_cast<const std::byte*>(&args) + sizeof(StringId));
 
+        StringManager::setCurrencyOverride(nullptr);
         ObjectManager::freeTemporaryObject();
+    }
 
-        // Original didn't clean up like this
-        if (previousCurrency)
-        {
-            ObjectManager::unload(options.currency);
-            ObjectManager::load(*previousCurrency);
-            ObjectManager::reloadAll();
-            Gfx::loadCurrency();
-        }
+    static uint32_t getFileDateHash(const fs::directory_entry& file)
+    {
+        const auto lastWrite = file.last_write_time().time_since_epoch().count();
+        return static_cast<uint32_t>((lastWrite >> 32) ^ (lastWrite & 0xFFFFFFFF));
     }
 
     static std::optional<uint32_t> findScenario(const fs::path& fileName)
@@ -272,7 +274,8 @@ namespace OpenLoco::ScenarioManager
     }
 
     // 0x004447DF
-    static void createIndex(const ScenarioFolderState& currentState)
+    // Unless rereadAll is set only files whose size or date differ from their entry are read again.
+    static void createIndex(const ScenarioFolderState& currentState, bool rereadAll)
     {
         auto indexAllocSize = _scenarioHeader->numScenarios;
         if (_scenarioList == reinterpret_cast<ScenarioIndexEntry*>(-1) || _scenarioList == nullptr)
@@ -288,7 +291,7 @@ namespace OpenLoco::ScenarioManager
             std::fill(*_scenarioList, *_scenarioList + currentState.numFiles, ScenarioIndexEntry{});
         }
         _scenarioHeader->state = currentState;
-        _scenarioHeader->state.numFiles = (currentState.numFiles & 0xFFFFFF) | (1 << 24);
+        _scenarioHeader->state.numFiles = (currentState.numFiles & 0xFFFFFF) | (kCurrentIndexVersion << 24);
 
         for (uint32_t i = 0; i < _scenarioHeader->numScenarios; i++)
         {
@@ -312,6 +315,18 @@ namespace OpenLoco::ScenarioManager
             const auto u8FileName = file.path().filename().u8string();
             auto foundId = findScenario(u8FileName);
 
+            const auto fileSize = static_cast<uint32_t>(file.file_size());
+            const auto fileDateHash = getFileDateHash(file);
+            if (foundId.has_value() && !rereadAll)
+            {
+                ScenarioIndexEntry& entry = _scenarioList[*foundId];
+                if (entry.fileSize == fileSize && entry.fileDateHash == fileDateHash)
+                {
+                    entry.flags |= ScenarioIndexFlags::flag_0;
+                    continue;
+                }
+            }
+
             const auto options = S5::readScenarioOptions(file.path());
             if (options == nullptr)
             {
@@ -353,6 +368,8 @@ namespace OpenLoco::ScenarioManager
             entry.competingCompanyDelay = options->competitorStartDelay;
 
             entry.currency = options->currency;
+            entry.fileSize = fileSize;
+            entry.fileDateHash = fileDateHash;
             loadScenarioProgress(entry, *options);
             if (!foundId.has_value())
             {
@@ -383,7 +400,9 @@ namespace OpenLoco::ScenarioManager
         const auto currentState = getCurrentScenarioFolderState();
         if (forceReload || !tryLoadIndex(currentState))
         {
-            createIndex(currentState);
+            // Entries read with an older version or another language can not be reused
+            const bool rereadAll = forceReload || (_scenarioHeader->state.numFiles >> 24) != kCurrentIndexVersion;
+            createIndex(currentState, rereadAll);
         }
 
         setAllScreenFlags(oldFlags);
@@ -29,7 +29,10 @@ namespace OpenLoco::ScenarioManager
         uint8_t category;               // 0x100
         uint8_t numCompetingCompanies;  // 0x101
         uint8_t competingCompanyDelay;  // 0x102
-        uint8_t pad_103[0x120 - 0x103]; // 0x103
+        uint8_t pad_103;                // 0x103
+        uint32_t fileSize;              // 0x104 OpenLoco only, the file this entry was last read from
+        uint32_t fileDateHash;          // 0x108 OpenLoco only
+        uint8_t pad_10C[0x120 - 0x10C]; // 0x10C
         uint16_t startYear;             // 0x120
         uint16_t completedMonths;       // 0x122
         char scenarioName[0x40];        // 0x124
@@ -31,6 +31,7 @@
 
 #include "Config.h"
 #include "Drawing/FPSCounter.h"
+#include "Drawing/ProfilerOverlay.h"
 #include "Game.h"
 #include "GameCommands/GameCommands.h"
 #include "GameCommands/General/LoadSaveQuit.h"
@@ -48,6 +49,7 @@
 #include "Window.h"
 #include "World/CompanyManager.h"
 #include <OpenLoco/Core/Exception.hpp>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Utility/String.hpp>
 
@@ -417,7 +419,16 @@ namespace OpenLoco::Ui
             Drawing::drawFPS();
         }
 
+        if (Config::get().showProfiler)
+        {
+            Drawing::drawProfilerOverlay();
+        }
+
         drawingEngine.present();
+
+        // A frame ends once it has been presented
+        Profiling::setEnabled(Config::get().showProfiler);
+        Profiling::endFrame();
     }
 
     // 0x00406FBA
@@ -10,10 +10,14 @@
 #include <OpenLoco/Core/Exception.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <OpenLoco/Platform/Platform.h>
+#include <algorithm>
+#include <array>
 #include <cstdint>
 #include <fstream>
+#include <future>
 #include <png.h>
 #include <string>
+#include <vector>
 
 #pragma warning(disable : 4611) // interaction between '_setjmp' and C++ object destruction is non-portable
 
@@ -26,6 +30,9 @@ namespace OpenLoco::Ui
 
     static ScreenshotType _screenshotType = ScreenshotType::regular;
 
+    // Rows of the giant screenshot rendered at a time, bounds its memory use regardless of map size
+    static constexpr int32_t kGiantScreenshotStripHeight = 256;
+
     void triggerScreenshotCountdown(int8_t numTicks, ScreenshotType type)
     {
         _screenshotCountdown = numTicks;
@@ -73,69 +80,113 @@ namespace OpenLoco::Ui
         ostream->flush();
     }
 
-    static void saveRenderTargetToPng(Gfx::RenderTarget& rt, std::fstream& outputStream)
+    // Writes a paletted image whose rows are handed over as they become available. Every call sets
+    // up its own error handler so the rows can be written from a different thread than the header.
+    class PngWriter
     {
-        static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
+    private:
+        png_structp _pngPtr = nullptr;
+        png_infop _infoPtr = nullptr;
+        png_colorp _palette = nullptr;
 
-        png_structp pngPtr = nullptr;
-        png_colorp palette = nullptr;
-        try
+        void destroy()
         {
-            pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
-            if (pngPtr == nullptr)
-                throw Exception::RuntimeError("png_create_write_struct failed.");
+            if (_pngPtr != nullptr)
+            {
+                png_free(_pngPtr, _palette);
+                png_destroy_write_struct(&_pngPtr, &_infoPtr);
+            }
+            _palette = nullptr;
+        }
 
-            png_set_write_fn(pngPtr, &outputStream, pngWriteData, pngFlush);
+    public:
+        PngWriter(std::ostream& outputStream, int32_t width, int32_t height)
+        {
+            static loco_global<uint8_t[256][4], 0x0113ED20> _113ED20;
 
-            // Set error handler
-            if (setjmp(png_jmpbuf(pngPtr)))
+            try
             {
-                throw Exception::RuntimeError("PNG ERROR");
-            }
+                _pngPtr = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+                if (_pngPtr == nullptr)
+                    throw Exception::RuntimeError("png_create_write_struct failed.");
 
-            auto infoPtr = png_create_info_struct(pngPtr);
-            if (infoPtr == nullptr)
-                throw Exception::RuntimeError("png_create_info_struct failed.");
+                png_set_write_fn(_pngPtr, &outputStream, pngWriteData, pngFlush);
 
-            palette = (png_colorp)png_malloc(pngPtr, 246 * sizeof(png_color));
-            if (palette == nullptr)
-                throw Exception::RuntimeError("png_malloc failed.");
+                // Set error handler
+                if (setjmp(png_jmpbuf(_pngPtr)))
+                {
+                    throw Exception::RuntimeError("PNG ERROR");
+                }
+
+                _infoPtr = png_create_info_struct(_pngPtr);
+                if (_infoPtr == nullptr)
+                    throw Exception::RuntimeError("png_create_info_struct failed.");
+
+                _palette = (png_colorp)png_malloc(_pngPtr, 246 * sizeof(png_color));
+                if (_palette == nullptr)
+                    throw Exception::RuntimeError("png_malloc failed.");
+
+                for (size_t i = 0; i < 246; i++)
+                {
+                    _palette[i].blue = _113ED20[i][0];
+                    _palette[i].green = _113ED20[i][1];
+                    _palette[i].red = _113ED20[i][2];
+                }
+                png_set_PLTE(_pngPtr, _infoPtr, _palette, 246);
 
-            for (size_t i = 0; i < 246; i++)
+                png_byte transparentIndex = 0;
+                png_set_tRNS(_pngPtr, _infoPtr, &transparentIndex, 1, nullptr);
+                png_set_IHDR(_pngPtr, _infoPtr, width, height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+                png_write_info(_pngPtr, _infoPtr);
+            }
+            catch (const std::exception&)
             {
-                palette[i].blue = _113ED20[i][0];
-                palette[i].green = _113ED20[i][1];
-                palette[i].red = _113ED20[i][2];
+                destroy();
+                throw;
             }
-            png_set_PLTE(pngPtr, infoPtr, palette, 246);
+        }
 
-            png_byte transparentIndex = 0;
-            png_set_tRNS(pngPtr, infoPtr, &transparentIndex, 1, nullptr);
-            png_set_IHDR(pngPtr, infoPtr, rt.width, rt.height, 8, PNG_COLOR_TYPE_PALETTE, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
-            png_write_info(pngPtr, infoPtr);
+        PngWriter(const PngWriter&) = delete;
+        PngWriter& operator=(const PngWriter&) = delete;
+
+        ~PngWriter()
+        {
+            destroy();
+        }
 
-            uint8_t* data = rt.bits;
-            for (int y = 0; y < rt.height; y++)
+        void writeRows(const uint8_t* data, int32_t numRows, int32_t stride)
+        {
+            if (setjmp(png_jmpbuf(_pngPtr)))
             {
-                png_write_row(pngPtr, data);
-                data += rt.pitch + rt.width;
+                throw Exception::RuntimeError("PNG ERROR");
             }
 
-            png_write_end(pngPtr, nullptr);
-            png_destroy_info_struct(pngPtr, &infoPtr);
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
+            for (int32_t y = 0; y < numRows; y++)
+            {
+                png_write_row(_pngPtr, data);
+                data += stride;
+            }
         }
-        catch (const std::exception&)
+
+        void finish()
         {
-            png_free(pngPtr, palette);
-            png_destroy_write_struct(&pngPtr, nullptr);
-            throw;
+            if (setjmp(png_jmpbuf(_pngPtr)))
+            {
+                throw Exception::RuntimeError("PNG ERROR");
+            }
+
+            png_write_end(_pngPtr, nullptr);
         }
+    };
+
+    static void saveRenderTargetToPng(Gfx::RenderTarget& rt, std::fstream& outputStream)
+    {
+        PngWriter writer(outputStream, rt.width, rt.height);
+        writer.writeRows(rt.bits, rt.height, rt.width + rt.pitch);
+        writer.finish();
     }
 
-    // 0x00452667
-    static std::string prepareSaveScreenshot(Gfx::RenderTarget& rt)
+    static fs::path getScreenshotPath()
     {
         auto basePath = Platform::getUserDirectory();
         std::string scenarioName = S5::getOptions().scenarioName;
@@ -144,28 +195,28 @@ namespace OpenLoco::Ui
             scenarioName = StringManager::getString(StringIds::screenshot_filename_template);
 
         std::string fileName = std::string(scenarioName) + ".png";
-        fs::path path;
-        int16_t suffix;
-        for (suffix = 1; suffix < std::numeric_limits<int16_t>().max(); suffix++)
+        for (int16_t suffix = 1; suffix < std::numeric_limits<int16_t>().max(); suffix++)
         {
             if (!fs::exists(basePath / fileName))
             {
-                path = basePath / fileName;
-                break;
+                return basePath / fileName;
             }
 
             fileName = std::string(scenarioName) + " (" + std::to_string(suffix) + ").png";
         }
 
-        if (path.empty())
-        {
-            throw Exception::RuntimeError("Failed finding filename");
-        }
+        throw Exception::RuntimeError("Failed finding filename");
+    }
+
+    // 0x00452667
+    static std::string prepareSaveScreenshot(Gfx::RenderTarget& rt)
+    {
+        const auto path = getScreenshotPath();
 
         std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
         saveRenderTargetToPng(rt, outputStream);
 
-        return fileName;
+        return path.filename().u8string();
     }
 
     static std::string saveScreenshot()
@@ -174,7 +225,7 @@ namespace OpenLoco::Ui
         return prepareSaveScreenshot(rt);
     }
 
-    static Ui::Viewport createGiantViewport(const uint16_t resolutionWidth, const uint16_t resolutionHeight, const uint8_t zoomLevel)
+    Ui::Viewport createMapCentreViewport(const uint16_t resolutionWidth, const uint16_t resolutionHeight, const uint8_t zoomLevel)
     {
         Ui::Viewport viewport{};
         viewport.width = resolutionWidth;
@@ -198,35 +249,67 @@ namespace OpenLoco::Ui
         return viewport;
     }
 
-    static std::string saveGiantScreenshot()
+    void saveGiantScreenshot(const fs::path& path, uint8_t zoomLevel)
     {
-        const auto& main = WindowManager::getMainWindow();
-        const auto zoomLevel = main->viewports[0]->zoom;
-
         const uint16_t resolutionWidth = ((World::kMapColumns * 32 * 2) >> zoomLevel) + 8;
         const uint16_t resolutionHeight = ((World::kMapRows * 32 * 1) >> zoomLevel) + 128;
 
-        Ui::Viewport viewport = createGiantViewport(resolutionWidth, resolutionHeight, zoomLevel);
+        Ui::Viewport viewport = createMapCentreViewport(resolutionWidth, resolutionHeight, zoomLevel);
 
         // Ensure sprites appear regardless of rotation
         EntityManager::resetSpatialIndex();
 
-        Gfx::RenderTarget rt{};
-        rt.bits = static_cast<uint8_t*>(malloc(resolutionWidth * resolutionHeight));
-        if (rt.bits == nullptr)
-            return nullptr;
+        std::fstream outputStream(path.c_str(), std::ios::out | std::ios::binary);
+        if (!outputStream.is_open())
+            throw Exception::RuntimeError("Unable to open screenshot file.");
+
+        PngWriter writer(outputStream, resolutionWidth, resolutionHeight);
 
-        rt.x = 0;
-        rt.y = 0;
-        rt.width = resolutionWidth;
-        rt.height = resolutionHeight;
-        rt.pitch = 0;
-        rt.zoomLevel = 0;
+        // The map is painted a strip at a time, only one paint session can exist so the strips
+        // themselves are drawn in turn while the previous one is being compressed.
+        std::array<std::vector<uint8_t>, 2> strips;
+        std::future<void> pendingStrip;
+        for (int32_t top = 0, stripIndex = 0; top < resolutionHeight; top += kGiantScreenshotStripHeight, stripIndex ^= 1)
+        {
+            const auto numRows = std::min<int32_t>(kGiantScreenshotStripHeight, resolutionHeight - top);
+
+            auto& strip = strips[stripIndex];
+            strip.assign(resolutionWidth * numRows, 0);
+
+            Gfx::RenderTarget rt{};
+            rt.bits = strip.data();
+            rt.x = 0;
+            rt.y = top;
+            rt.width = resolutionWidth;
+            rt.height = numRows;
+            rt.pitch = 0;
+            rt.zoomLevel = 0;
+            viewport.render(&rt);
+
+            if (pendingStrip.valid())
+            {
+                pendingStrip.get();
+            }
+            pendingStrip = std::async(std::launch::async, [&writer, &strip, numRows, resolutionWidth]() {
+                writer.writeRows(strip.data(), numRows, resolutionWidth);
+            });
+        }
+        if (pendingStrip.valid())
+        {
+            pendingStrip.get();
+        }
+
+        writer.finish();
+    }
+
+    static std::string saveGiantScreenshot()
+    {
+        const auto& main = WindowManager::getMainWindow();
+        const auto zoomLevel = main->viewports[0]->zoom;
 
-        viewport.render(&rt);
-        auto fileName = prepareSaveScreenshot(rt);
-        free(rt.bits);
+        const auto path = getScreenshotPath();
+        saveGiantScreenshot(path, zoomLevel);
 
-        return fileName;
+        return path.filename().u8string();
     }
 }
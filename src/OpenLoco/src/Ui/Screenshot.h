@@ -1,9 +1,12 @@
 #pragma once
 
+#include <OpenLoco/Core/FileSystem.hpp>
 #include <cstdint>
 
 namespace OpenLoco::Ui
 {
+    struct Viewport;
+
     enum class ScreenshotType : uint8_t
     {
         regular = 0,
@@ -12,4 +15,8 @@ namespace OpenLoco::Ui
 
     void triggerScreenshotCountdown(int8_t numTicks, ScreenshotType type);
     void handleScreenshotCountdown();
+    // Renders the whole map at the given zoom level, throws if the file can not be written.
+    void saveGiantScreenshot(const fs::path& path, uint8_t zoomLevel);
+    // Viewport at the top left of the screen looking at the centre of the map.
+    Viewport createMapCentreViewport(uint16_t resolutionWidth, uint16_t resolutionHeight, uint8_t zoomLevel);
 }
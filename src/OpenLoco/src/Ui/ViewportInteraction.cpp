@@ -36,6 +36,7 @@
 #include "Objects/TreeObject.h"
 #include "Objects/WallObject.h"
 #include "Paint/Paint.h"
+#include "Paint/PaintPickBuffer.h"
 #include "SceneManager.h"
 #include "Ui.h"
 #include "Ui/ScrollView.h"
@@ -1346,13 +1347,43 @@ namespace OpenLoco::Ui::ViewportInteraction
         }
     }
 
+    static loco_global<uint8_t, 0x0050BF68> _50BF68; // If in get map coords
+    static loco_global<Gfx::RenderTarget, 0x00E0C3E4> _rt1;
+    static loco_global<Gfx::RenderTarget, 0x00E0C3F4> _rt2;
+
+    // Session of the single pixel of vp at screenPos
+    static Paint::PaintSession* allocateHitTestSession(const Viewport& vp, const Point& screenPos)
+    {
+        auto vpPos = vp.screenToViewport({ screenPos.x, screenPos.y });
+        _rt1->zoomLevel = vp.zoom;
+        _rt1->x = (0xFFFF << vp.zoom) & vpPos.x;
+        _rt1->y = (0xFFFF << vp.zoom) & vpPos.y;
+        _rt2->x = _rt1->x;
+        _rt2->y = _rt1->y;
+        _rt2->width = 1;
+        _rt2->height = 1;
+        _rt2->zoomLevel = _rt1->zoomLevel;
+        Paint::SessionOptions options{};
+        options.rotation = vp.getRotation();
+        options.viewFlags = vp.flags;
+        // Todo: should this pass the cullHeight...
+        return Paint::allocateSession(_rt2, options);
+    }
+
+    InteractionArg hitTest(const Viewport& vp, const Point& screenPos, InteractionItemFlags flags)
+    {
+        _50BF68 = 1;
+        auto* session = allocateHitTestSession(vp, screenPos);
+        session->generate();
+        session->arrangeStructs();
+        const auto interaction = session->getNormalInteractionInfo(flags);
+        _50BF68 = 0;
+        return interaction;
+    }
+
     // 0x00459E54
     std::pair<ViewportInteraction::InteractionArg, Viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, InteractionItemFlags flags)
     {
-        static loco_global<uint8_t, 0x0050BF68> _50BF68; // If in get map coords
-        static loco_global<Gfx::RenderTarget, 0x00E0C3E4> _rt1;
-        static loco_global<Gfx::RenderTarget, 0x00E0C3F4> _rt2;
-
         _50BF68 = 1;
         ViewportInteraction::InteractionArg interaction{};
         Ui::Point screenPos = { static_cast<int16_t>(screenX), static_cast<int16_t>(screenY) };
@@ -1373,23 +1404,20 @@ namespace OpenLoco::Ui::ViewportInteraction
                 continue;
 
             chosenV = vp;
-            auto vpPos = vp->screenToViewport({ screenPos.x, screenPos.y });
-            _rt1->zoomLevel = vp->zoom;
-            _rt1->x = (0xFFFF << vp->zoom) & vpPos.x;
-            _rt1->y = (0xFFFF << vp->zoom) & vpPos.y;
-            _rt2->x = _rt1->x;
-            _rt2->y = _rt1->y;
-            _rt2->width = 1;
-            _rt2->height = 1;
-            _rt2->zoomLevel = _rt1->zoomLevel;
-            Paint::SessionOptions options{};
-            options.rotation = vp->getRotation();
-            options.viewFlags = vp->flags;
-            // Todo: should this pass the cullHeight...
-            auto* session = Paint::allocateSession(_rt2, options);
-            session->generate();
-            session->arrangeStructs();
-            interaction = session->getNormalInteractionInfo(flags);
+            auto* session = allocateHitTestSession(*vp, screenPos);
+            // The pick buffer only has the topmost item at the pixel, if that is filtered out (or
+            // has since been removed) the items below it are found by hit testing a paint session.
+            auto picked = Paint::PickBuffer::get(*vp, screenPos);
+            if (picked.has_value() && Paint::isPSSpriteTypeInFilter(picked->type, flags))
+            {
+                interaction = *picked;
+            }
+            else
+            {
+                session->generate();
+                session->arrangeStructs();
+                interaction = session->getNormalInteractionInfo(flags);
+            }
             if (!vp->hasFlags(ViewportFlags::station_names_displayed))
             {
                 if (_rt2->zoomLevel <= Config::get().old.stationNamesMinScale)
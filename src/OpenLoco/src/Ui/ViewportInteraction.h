@@ -96,6 +96,8 @@ namespace OpenLoco::Ui::ViewportInteraction
 
     void handleRightReleased(Window* window, int16_t xPos, int16_t yPos);
 
+    // Topmost item of flags drawn at screenPos by vp, found by hit testing a paint session of the pixel (never the pick buffer).
+    InteractionArg hitTest(const Viewport& vp, const Point& screenPos, InteractionItemFlags flags);
     std::pair<ViewportInteraction::InteractionArg, Ui::Viewport*> getMapCoordinatesFromPos(int32_t screenX, int32_t screenY, InteractionItemFlags flags);
     std::optional<World::Pos2> getSurfaceOrWaterLocFromUi(const Point& screenCoords);
     std::optional<std::pair<World::Pos2, Ui::Viewport*>> getSurfaceLocFromUi(const Point& screenCoords);
@@ -14,6 +14,7 @@
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
 #include "MultiPlayer.h"
+#include "Paint/PaintPickBuffer.h"
 #include "SceneManager.h"
 #include "ScrollView.h"
 #include "Tutorial.h"
@@ -25,6 +26,7 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 #include <algorithm>
 #include <cinttypes>
@@ -1809,6 +1811,8 @@ namespace OpenLoco::Ui::WindowManager
             to += stride;
             from += stride;
         }
+
+        Paint::PickBuffer::moveRect(x, y, width, height, dx, dy);
     }
 
     /**
@@ -2221,6 +2225,8 @@ namespace OpenLoco::Ui::WindowManager
 
     void render(Gfx::RenderTarget& rt, const Rect& rect)
     {
+        OPENLOCO_PROFILE_SCOPE("WindowManager::render");
+
         for (size_t i = 0; i < count(); i++)
         {
             auto w = get(i);
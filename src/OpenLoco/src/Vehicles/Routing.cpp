@@ -16,6 +16,10 @@
 #include "World/CompanyManager.h"
 #include <OpenLoco/Engine/World.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <span>
+#include <unordered_map>
+#include <vector>
 
 namespace OpenLoco::Vehicles
 {
@@ -458,9 +462,9 @@ namespace OpenLoco::Vehicles
     }
 
     // 0x004A2CE7
-    static void setSignalsOccupiedState(const LocationOfInterestHashMap& hashMap, const uint16_t& routingTransformData)
+    static void setSignalsOccupiedState(std::span<const LocationOfInterest> interests, const uint16_t& routingTransformData)
     {
-        for (const auto& interest : hashMap)
+        for (const auto& interest : interests)
         {
             if (!(interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal))
             {
@@ -681,14 +685,80 @@ namespace OpenLoco::Vehicles
         transformFunction(interestMap);
     }
 
-    // 0x004A2AD7
-    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    // The track visited by the signal block walks of sub_4A2AD7 and sub_4A2A58 only depends on the
+    // track and signal elements (both stop at signals) so is cached until those change nearby.
+    // Only the per interest filters (vehicle occupancy, signal state) are evaluated on every call.
+    struct SignalBlock
     {
-        // 0x001135F88
-        uint16_t routingTransformData = 0;
+        std::vector<LocationOfInterest> interests; // In the order the walk added them
+        std::vector<LocationOfInterest> signals;   // In the order of the walk's hash map
+        World::Pos2 min;
+        World::Pos2 max;
+        bool hasDeadEnd; // Walk set _1136085 bit 0
+    };
+
+    struct SignalBlockKeyHash
+    {
+        size_t operator()(const LocationOfInterest& interest) const
+        {
+            size_t hash = static_cast<uint16_t>(interest.loc.x) | (static_cast<uint16_t>(interest.loc.y) << 16);
+            hash = hash * 31 + static_cast<uint16_t>(interest.loc.z);
+            hash = hash * 31 + interest.trackAndDirection;
+            hash = hash * 31 + ((enumValue(interest.company) << 8) | interest.trackType);
+            return hash;
+        }
+    };
+
+    // Large enough for every junction of a late game network, dropped completely when exceeded.
+    static constexpr size_t kMaxSignalBlocks = 8192;
+    // Track pieces span up to 4 tiles so a change can alter connections this far from a piece start.
+    static constexpr coord_t kSignalBlockChangeMargin = 8 * World::kTileSize;
+
+    static std::unordered_map<LocationOfInterest, SignalBlock, SignalBlockKeyHash> _signalBlocks;
+
+    void invalidateSignalBlocks(const World::Pos2& pos)
+    {
+        std::erase_if(_signalBlocks, [&pos](const auto& entry) {
+            const auto& block = entry.second;
+            return pos.x >= block.min.x - kSignalBlockChangeMargin && pos.x <= block.max.x + kSignalBlockChangeMargin
+                && pos.y >= block.min.y - kSignalBlockChangeMargin && pos.y <= block.max.y + kSignalBlockChangeMargin;
+        });
+    }
 
-        auto filterFunction = [&routingTransformData](const LocationOfInterest& interest) { return findOccupationByBlock(interest, routingTransformData); };
-        auto transformFunction = [&routingTransformData](const LocationOfInterestHashMap& interestMap) { setSignalsOccupiedState(interestMap, routingTransformData); };
+    void invalidateAllSignalBlocks()
+    {
+        _signalBlocks.clear();
+    }
+
+    static const SignalBlock& getSignalBlock(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    {
+        const auto key = LocationOfInterest{ loc, trackAndDirection._data, company, trackType };
+        if (auto it = _signalBlocks.find(key); it != _signalBlocks.end())
+        {
+            // Leave the globals as the walk would have
+            _findTrackNetworkFlags = TrackNetworkSearchFlags::unk0 | TrackNetworkSearchFlags::unk2;
+            _113601A[0] = 0;
+            _113601A[1] = 0;
+            if (it->second.hasDeadEnd)
+            {
+                _1136085 = *_1136085 | (1 << 0);
+            }
+            return it->second;
+        }
+
+        SignalBlock block{};
+        block.min = loc;
+        block.max = loc;
+
+        const auto previous1136085 = *_1136085;
+        _1136085 = previous1136085 & ~(1 << 0);
+
+        auto filterFunction = [&block](const LocationOfInterest& interest) {
+            block.interests.push_back(interest);
+            block.min = { std::min(block.min.x, interest.loc.x), std::min(block.min.y, interest.loc.y) };
+            block.max = { std::max(block.max.x, interest.loc.x), std::max(block.max.y, interest.loc.y) };
+            return (interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal) != 0;
+        };
         LocationOfInterestHashMap interestMap{ kSignalHashMapSize };
 
         findAllTracksFilterTransform(
@@ -699,26 +769,50 @@ namespace OpenLoco::Vehicles
             company,
             trackType,
             filterFunction,
-            transformFunction);
+            kNullTransformFunction);
+
+        block.hasDeadEnd = (*_1136085 & (1 << 0)) != 0;
+        _1136085 = *_1136085 | previous1136085;
+
+        for (const auto& interest : interestMap)
+        {
+            if (interest.trackAndDirection & World::Track::AdditionalTaDFlags::hasSignal)
+            {
+                block.signals.push_back(interest);
+            }
+        }
+
+        if (_signalBlocks.size() >= kMaxSignalBlocks)
+        {
+            _signalBlocks.clear();
+        }
+        return _signalBlocks.emplace(key, std::move(block)).first->second;
+    }
+
+    // 0x004A2AD7
+    void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
+    {
+        // 0x001135F88
+        uint16_t routingTransformData = 0;
+
+        const auto& block = getSignalBlock(loc, trackAndDirection, company, trackType);
+        for (const auto& interest : block.interests)
+        {
+            findOccupationByBlock(interest, routingTransformData);
+        }
+        setSignalsOccupiedState(block.signals, routingTransformData);
     }
 
     uint8_t sub_4A2A58(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType)
     {
         // 0x001135F88
         uint16_t unk = 0;
-        LocationOfInterestHashMap interestMap{ kSignalHashMapSize };
-        auto filterFunction = [&unk](const LocationOfInterest& interest) { return sub_4A2D4C(interest, unk); };
-
-        findAllTracksFilterTransform(
-            interestMap,
-            TrackNetworkSearchFlags::unk0 | TrackNetworkSearchFlags::unk2,
-            loc,
-            trackAndDirection,
-            company,
-            trackType,
-            filterFunction,
-            kNullTransformFunction);
 
+        const auto& block = getSignalBlock(loc, trackAndDirection, company, trackType);
+        for (const auto& interest : block.interests)
+        {
+            sub_4A2D4C(interest, unk);
+        }
         return unk;
     }
 
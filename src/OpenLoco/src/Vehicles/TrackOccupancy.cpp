@@ -0,0 +1,189 @@
+#include "TrackOccupancy.h"
+#include "Entities/EntityManager.h"
+#include "Logging.h"
+#include "VehicleManager.h"
+#include <algorithm>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::Vehicles::TrackOccupancy
+{
+    using Key = uint64_t;
+
+    // Vehicles on each track piece, almost always only the one
+    static std::unordered_map<Key, std::vector<EntityId>> _vehiclesAt;
+    // Where each vehicle was last indexed, to find the entry again once it has moved on
+    static std::unordered_map<EntityId, Key> _indexedAt;
+    static bool _isValid = false;
+
+    static constexpr Key makeKey(coord_t tileX, coord_t tileY, World::SmallZ baseZ, const TrackAndDirection::_TrackAndDirection tad)
+    {
+        return (static_cast<Key>(static_cast<uint16_t>(tileX)) << 48)
+            | (static_cast<Key>(static_cast<uint16_t>(tileY)) << 32)
+            | (static_cast<Key>(baseZ) << 16)
+            | tad._data;
+    }
+
+    static Vehicle2* getVehicle2(VehicleHead& head)
+    {
+        auto* veh1 = head.nextVehicleComponent();
+        if (veh1 == nullptr)
+        {
+            return nullptr;
+        }
+        auto* veh2 = veh1->nextVehicleComponent();
+        return veh2 != nullptr ? veh2->asVehicle2() : nullptr;
+    }
+
+    static std::optional<Key> getKey(VehicleHead& head)
+    {
+        const auto* veh2 = getVehicle2(head);
+        if (veh2 == nullptr || veh2->tileX == -1)
+        {
+            return std::nullopt;
+        }
+        return makeKey(veh2->tileX, veh2->tileY, veh2->tileBaseZ, veh2->trackAndDirection.track);
+    }
+
+    static void remove(EntityId head)
+    {
+        auto it = _indexedAt.find(head);
+        if (it == _indexedAt.end())
+        {
+            return;
+        }
+
+        auto slot = _vehiclesAt.find(it->second);
+        if (slot != _vehiclesAt.end())
+        {
+            auto& heads = slot->second;
+            heads.erase(std::remove(heads.begin(), heads.end(), head), heads.end());
+            if (heads.empty())
+            {
+                _vehiclesAt.erase(slot);
+            }
+        }
+        _indexedAt.erase(it);
+    }
+
+    static void insert(EntityId head, Key key)
+    {
+        _vehiclesAt[key].push_back(head);
+        _indexedAt[head] = key;
+    }
+
+    static void rebuild()
+    {
+        _vehiclesAt.clear();
+        _indexedAt.clear();
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            if (const auto key = getKey(*head))
+            {
+                insert(head->id, *key);
+            }
+        }
+        _isValid = true;
+    }
+
+    void invalidate()
+    {
+        _isValid = false;
+    }
+
+    void refresh(EntityId id)
+    {
+        // Will be rebuilt from scratch anyway
+        if (!_isValid)
+        {
+            return;
+        }
+
+        auto* component = EntityManager::get<VehicleBase>(id);
+        auto* head = component != nullptr ? component->asVehicleHead() : nullptr;
+        const auto key = head != nullptr ? getKey(*head) : std::nullopt;
+
+        auto it = _indexedAt.find(id);
+        if (it != _indexedAt.end() && key == it->second)
+        {
+            return;
+        }
+        remove(id);
+        if (key.has_value())
+        {
+            insert(id, *key);
+        }
+    }
+
+    VehicleHead* findVehicle(const World::Pos3& pos, const TrackAndDirection::_TrackAndDirection tad)
+    {
+        if (!_isValid)
+        {
+            rebuild();
+        }
+
+        const auto baseZ = static_cast<World::SmallZ>(pos.z / World::kSmallZStep);
+        auto slot = _vehiclesAt.find(makeKey(pos.x, pos.y, baseZ, tad));
+        if (slot == _vehiclesAt.end())
+        {
+            return nullptr;
+        }
+
+        for (const auto id : slot->second)
+        {
+            auto* component = EntityManager::get<VehicleBase>(id);
+            auto* head = component != nullptr ? component->asVehicleHead() : nullptr;
+            if (head == nullptr)
+            {
+                continue;
+            }
+            const auto* veh2 = getVehicle2(*head);
+            if (veh2 != nullptr
+                && veh2->tileX == pos.x
+                && veh2->tileY == pos.y
+                && veh2->tileBaseZ == baseZ
+                && veh2->trackAndDirection.track == tad)
+            {
+                return head;
+            }
+        }
+        return nullptr;
+    }
+
+    bool verify()
+    {
+        // Nothing to compare yet, but from now on it is kept up to date for the next call
+        if (!_isValid)
+        {
+            rebuild();
+            return true;
+        }
+
+        bool matches = true;
+        size_t numIndexed = 0;
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            const auto key = getKey(*head);
+            auto it = _indexedAt.find(head->id);
+            const auto indexed = it != _indexedAt.end() ? std::optional<Key>(it->second) : std::nullopt;
+            if (key != indexed)
+            {
+                Logging::error("Track occupancy of vehicle {} is {:016X}, indexed as {:016X}", enumValue(head->id), key.value_or(0), indexed.value_or(0));
+                matches = false;
+            }
+            if (indexed.has_value())
+            {
+                numIndexed++;
+            }
+        }
+        if (numIndexed != _indexedAt.size())
+        {
+            Logging::error("Track occupancy index has {} vehicles that no longer exist", _indexedAt.size() - numIndexed);
+            matches = false;
+        }
+        return matches;
+    }
+}
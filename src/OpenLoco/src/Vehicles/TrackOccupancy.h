@@ -0,0 +1,24 @@
+#pragma once
+
+#include "Vehicle.h"
+#include <OpenLoco/Engine/World.hpp>
+
+/**
+ * Index of the track piece each vehicle's Vehicle2 component is on, so "is a train here" queries
+ * do not need to walk every vehicle. Entries are refreshed after each vehicle updates, anything
+ * else that can move vehicles around (game commands, loading a game) throws the whole index away
+ * and it is rebuilt by the next query.
+ */
+namespace OpenLoco::Vehicles::TrackOccupancy
+{
+    void invalidate();
+    // Called after the vehicle has updated, it may no longer exist.
+    void refresh(EntityId head);
+
+    // Only ever returns a vehicle that is actually there, nullptr if there is none.
+    VehicleHead* findVehicle(const World::Pos3& pos, const TrackAndDirection::_TrackAndDirection tad);
+
+    // Compares the index with a scan of every vehicle, logs and returns false on any difference.
+    // An index that has been thrown away is rebuilt instead and always matches.
+    bool verify();
+}
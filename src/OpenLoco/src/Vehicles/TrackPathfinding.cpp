@@ -0,0 +1,763 @@
+#include "TrackPathfinding.h"
+#include "Logging.h"
+#include "Map/Track/TrackData.h"
+#include "OrderManager.h"
+#include "Random.h"
+#include "Tutorial.h"
+#include "Vehicle.h"
+#include "World/StationManager.h"
+#include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+using namespace OpenLoco::Interop;
+using namespace OpenLoco::Diagnostics;
+using namespace OpenLoco::World::Track;
+
+namespace OpenLoco::Vehicles::TrackPathfinding
+{
+    static loco_global<World::Track::TrackConnections, 0x0113609C> _113609C;
+    static loco_global<uint8_t[2], 0x0113601A> _113601A; // Track Connection mod global
+    static loco_global<StationId, 0x01135FAE> _1135FAE;
+    static loco_global<uint8_t, 0x0113607D> _113607D;
+    static loco_global<uint32_t, 0x011360CC> _11360CC;
+    // Walk state, shared with the road route choice (0x0047DFD0)
+    static loco_global<uint16_t, 0x0113642C> _113642C; // Junction depth
+    static loco_global<uint16_t, 0x0113642E> _113642E; // Signals seen
+    static loco_global<uint32_t, 0x01136430> _1136430; // Distance walked
+    static loco_global<uint32_t, 0x01136434> _1136434; // Longest distance walked
+    static loco_global<uint32_t, 0x01136438> _1136438; // Random tie breaker
+    static loco_global<uint32_t, 0x0113643C> _113643C; // Best route distance
+    static loco_global<uint32_t, 0x01136440> _1136440; // Best route connection index
+    static loco_global<uint32_t, 0x01136444> _1136444; // Route distance
+    static loco_global<uint16_t, 0x01136448> _1136448; // Route distance left to the target
+    static loco_global<StationId, 0x0113644A> _113644A; // Target station
+    static loco_global<uint32_t, 0x0113644C> _113644C; // Route signal rating
+    static loco_global<uint32_t, 0x01136450> _1136450; // Best route signal rating
+    static loco_global<uint16_t, 0x01136456> _1136456; // Best route distance left to the target
+    static loco_global<uint16_t, 0x01136458> _1136458;
+    static loco_global<World::Pos3, 0x0113645A> _113645A; // Target
+    static loco_global<uint16_t, 0x01136460> _1136460;    // Target waypoint track and direction
+    static loco_global<World::Pos3, 0x01136462> _1136462; // Target waypoint reversed
+    static loco_global<uint16_t, 0x01136468> _1136468;    // Target waypoint reversed track and direction
+    // All of the above from 0x0113642C, for comparing with the original
+    static loco_global<uint8_t[0x3E], 0x0113642C> _walkState;
+
+    static constexpr uint16_t kMaxDepth = 5;
+    static constexpr uint32_t kMaxDistance = 0x500;
+    static constexpr uint32_t kNoRating = 0xFFFFFFFFU;
+    static constexpr uint32_t kNoBestRoute = 0xFFFFFFFEU;
+
+    // 0x00500234 Rating of a route by the kinds of signal seen along it
+    static constexpr std::array<uint16_t, 8> kSignalsSeenRating = { 10, 0, 70, 70, 40, 40, 70, 70 };
+
+    // A piece of track as the walk visits it, the station and level crossing are what looking up
+    // the connections at its end leaves in 0x01135FAE and 0x0113607D.
+    struct Piece
+    {
+        World::Pos3 pos;
+        uint16_t trackAndDirection; // Masked with basicTaDWithSignalMask
+        StationId station;
+        uint8_t levelCrossing;
+    };
+
+    // The track from one connection up to the next junction or dead end. Segments on a loop
+    // without junctions stop once they are longer than any walk goes.
+    struct Segment
+    {
+        std::vector<Piece> pieces;
+        World::Pos3 junctionPos;
+        World::Track::TrackConnections junction{}; // Empty for a dead end
+        bool isTruncated = false;
+        World::Pos2 min;
+        World::Pos2 max;
+    };
+
+    struct SegmentKey
+    {
+        World::Pos3 pos;
+        uint16_t trackAndDirection;
+        CompanyId company;
+        uint8_t trackType;
+        uint8_t mods; // The mods every piece must have (0x0113601A)
+
+        bool operator==(const SegmentKey& rhs) const
+        {
+            return (pos == rhs.pos) && (trackAndDirection == rhs.trackAndDirection) && (company == rhs.company) && (trackType == rhs.trackType) && (mods == rhs.mods);
+        }
+    };
+
+    struct SegmentKeyHash
+    {
+        size_t operator()(const SegmentKey& key) const
+        {
+            size_t hash = static_cast<uint16_t>(key.pos.x) | (static_cast<uint16_t>(key.pos.y) << 16);
+            hash = hash * 31 + static_cast<uint16_t>(key.pos.z);
+            hash = hash * 31 + key.trackAndDirection;
+            hash = hash * 31 + ((enumValue(key.company) << 16) | (key.trackType << 8) | key.mods);
+            return hash;
+        }
+    };
+
+    struct Network
+    {
+        CompanyId company;
+        uint8_t trackType;
+        uint8_t mods;
+    };
+
+    // Large enough for every junction of a late game network, dropped completely when exceeded
+    // before the next route choice.
+    static constexpr size_t kMaxSegments = 8192;
+    // Track pieces span up to 4 tiles so a change can alter connections this far from a piece start.
+    static constexpr coord_t kSegmentChangeMargin = 8 * World::kTileSize;
+
+    static std::unordered_map<SegmentKey, Segment, SegmentKeyHash> _segments;
+
+    static bool _compareWithOriginal = false;
+    static uint32_t _mismatches = 0;
+
+    void invalidate(const World::Pos2& pos)
+    {
+        std::erase_if(_segments, [&pos](const auto& entry) {
+            const auto& segment = entry.second;
+            return pos.x >= segment.min.x - kSegmentChangeMargin && pos.x <= segment.max.x + kSegmentChangeMargin
+                && pos.y >= segment.min.y - kSegmentChangeMargin && pos.y <= segment.max.y + kSegmentChangeMargin;
+        });
+    }
+
+    void invalidateAll()
+    {
+        _segments.clear();
+    }
+
+    static void extendBounds(Segment& segment, const World::Pos3& pos)
+    {
+        segment.min = { std::min(segment.min.x, pos.x), std::min(segment.min.y, pos.y) };
+        segment.max = { std::max(segment.max.x, pos.x), std::max(segment.max.y, pos.y) };
+    }
+
+    static const Segment& getSegment(const Network& network, const World::Pos3& pos, const uint16_t trackAndDirection)
+    {
+        const auto key = SegmentKey{ pos, trackAndDirection, network.company, network.trackType, network.mods };
+        if (auto it = _segments.find(key); it != _segments.end())
+        {
+            return it->second;
+        }
+
+        // Looking up connections beyond where the walk stops must not show in the globals
+        const StationId previousStation = _1135FAE;
+        const uint8_t previousLevelCrossing = _113607D;
+
+        Segment segment{};
+        segment.min = pos;
+        segment.max = pos;
+
+        auto piecePos = pos;
+        auto pieceTad = trackAndDirection;
+        uint32_t length = 0;
+        while (true)
+        {
+            extendBounds(segment, piecePos);
+            length += World::TrackData::getTrackLength(pieceTad >> 3 & 0x3F);
+            if (length > kMaxDistance)
+            {
+                segment.pieces.push_back(Piece{ piecePos, pieceTad, StationId::null, 0 });
+                segment.isTruncated = true;
+                break;
+            }
+
+            const auto [nextPos, nextRotation] = getTrackConnectionEnd(piecePos, pieceTad & AdditionalTaDFlags::basicTaDMask);
+            TrackConnections connections{};
+            getTrackConnections(nextPos, nextRotation, connections, network.company, network.trackType);
+            segment.pieces.push_back(Piece{ piecePos, pieceTad, _1135FAE, _113607D });
+
+            if (connections.size == 1)
+            {
+                piecePos = nextPos;
+                pieceTad = connections.data[0] & AdditionalTaDFlags::basicTaDWithSignalMask;
+                continue;
+            }
+
+            segment.junctionPos = nextPos;
+            extendBounds(segment, nextPos);
+            for (uint32_t i = 0; i < connections.size; ++i)
+            {
+                segment.junction.push_back(connections.data[i] & AdditionalTaDFlags::basicTaDWithSignalMask);
+            }
+            break;
+        }
+
+        _1135FAE = previousStation;
+        _113607D = previousLevelCrossing;
+
+        return _segments.emplace(key, std::move(segment)).first->second;
+    }
+
+    // Only between route choices as the walks keep references to segments while they recurse
+    static void evictSegmentsIfFull()
+    {
+        if (_segments.size() >= kMaxSegments)
+        {
+            _segments.clear();
+        }
+    }
+
+    static TrackAndDirection::_TrackAndDirection toTad(const uint16_t trackAndDirection)
+    {
+        return TrackAndDirection::_TrackAndDirection((trackAndDirection & 0x1F8) >> 3, trackAndDirection & 0x7);
+    }
+
+    // Adds the piece's length to the distance walked, false once the walk has gone far enough.
+    // Otherwise leaves the globals as looking up the connections at the end of the piece does.
+    static bool walkPiece(const Segment& segment, const Piece& piece)
+    {
+        _1136430 = _1136430 + World::TrackData::getTrackLength(toTad(piece.trackAndDirection).id());
+        if (_1136430 > kMaxDistance)
+        {
+            return false;
+        }
+        // Only the last piece of a truncated segment has no connections and it is always too far
+        assert(!segment.isTruncated || &piece != &segment.pieces.back());
+        _1135FAE = piece.station;
+        _113607D = piece.levelCrossing;
+        return true;
+    }
+
+    // 0x004AC884
+    static void walkRatingSignals(const Network& network, const World::Pos3& pos, const uint16_t trackAndDirection)
+    {
+        if (_113642C >= kMaxDepth)
+        {
+            return;
+        }
+        _113642C++;
+        const uint32_t distance = _1136430;
+
+        const auto walk = [&network](const Segment& segment) {
+            for (const auto& piece : segment.pieces)
+            {
+                if (piece.trackAndDirection & AdditionalTaDFlags::hasSignal)
+                {
+                    const auto state = getSignalState(piece.pos, toTad(piece.trackAndDirection), network.trackType, 0xA);
+                    if (state & (1 << 1))
+                    {
+                        _113642E = _113642E | (1 << 0);
+                        return;
+                    }
+                    if (state & (1 << 0))
+                    {
+                        _113642E = _113642E | (1 << 2);
+                        return;
+                    }
+                    _113642E = _113642E | (1 << 1);
+                }
+                if (!walkPiece(segment, piece))
+                {
+                    return;
+                }
+            }
+            const auto junctionPos = segment.junctionPos;
+            const auto junction = segment.junction;
+            for (uint32_t i = 0; i < junction.size; ++i)
+            {
+                walkRatingSignals(network, junctionPos, junction.data[i]);
+            }
+        };
+        walk(getSegment(network, pos, trackAndDirection));
+
+        _1136430 = distance;
+        _113642C--;
+    }
+
+    static bool isTargetWaypoint(const World::Pos3& pos, const uint16_t trackAndDirection)
+    {
+        const auto tad = trackAndDirection & AdditionalTaDFlags::basicTaDMask;
+        return (pos == _113645A && tad == _1136460) || (pos == _1136462 && tad == _1136468);
+    }
+
+    static uint16_t absoluteDifference(const coord_t a, const coord_t b)
+    {
+        const auto difference = static_cast<int16_t>(a - b);
+        return static_cast<uint16_t>(difference < 0 ? -difference : difference);
+    }
+
+    // 0x004AC94F
+    static void walkTowardsTarget(const Network& network, const World::Pos3& pos, const uint16_t trackAndDirection)
+    {
+        if (_113642C >= kMaxDepth)
+        {
+            return;
+        }
+        _113642C++;
+        const uint32_t distance = _1136430;
+
+        const auto walk = [&network](const Segment& segment) {
+            for (const auto& piece : segment.pieces)
+            {
+                const bool isTarget = _113644A != StationId::null ? _1135FAE == _113644A : isTargetWaypoint(piece.pos, piece.trackAndDirection);
+                if (isTarget)
+                {
+                    if (_1136448 != 0 || _1136430 <= _1136444)
+                    {
+                        _1136448 = 0;
+                        _1136444 = _1136430;
+                        if (_113644C == kNoRating)
+                        {
+                            _113644C = 1;
+                        }
+                        return;
+                    }
+                }
+                else
+                {
+                    const World::Pos3 target = _113645A;
+                    auto major = absoluteDifference(target.x, piece.pos.x);
+                    auto minor = absoluteDifference(target.y, piece.pos.y);
+                    if (major < minor)
+                    {
+                        std::swap(major, minor);
+                    }
+                    const uint16_t distanceLeft = major + (minor >> 2) + absoluteDifference(target.z, piece.pos.z);
+                    if (distanceLeft < _1136448 || (distanceLeft == _1136448 && _1136430 <= _1136444))
+                    {
+                        _1136448 = distanceLeft;
+                        _1136444 = _1136430;
+                    }
+                }
+
+                if (piece.trackAndDirection & AdditionalTaDFlags::hasSignal)
+                {
+                    const auto state = getSignalState(piece.pos, toTad(piece.trackAndDirection), network.trackType, 0xA);
+                    if (state & (1 << 1))
+                    {
+                        if (_113644C == kNoRating)
+                        {
+                            _113644C = 6;
+                        }
+                        return;
+                    }
+                    if (_113644C == kNoRating)
+                    {
+                        if (state & (1 << 0))
+                        {
+                            _113644C = (state & (1 << 2)) ? 3 : 4;
+                        }
+                        else
+                        {
+                            _113644C = 2;
+                        }
+                    }
+                }
+                if (!walkPiece(segment, piece))
+                {
+                    return;
+                }
+            }
+            if (segment.junction.size == 0)
+            {
+                return;
+            }
+
+            // The route is rated by the best of the routes beyond the junction
+            const auto junctionPos = segment.junctionPos;
+            const auto junction = segment.junction;
+            _11360CC = _113644C;
+            for (uint32_t i = 0; i < junction.size; ++i)
+            {
+                const uint32_t rating = _113644C;
+                const uint32_t bestRating = _11360CC;
+                _1135FAE = StationId::null;
+                walkTowardsTarget(network, junctionPos, junction.data[i]);
+                _11360CC = std::min<uint32_t>(bestRating, _113644C);
+                _113644C = rating;
+            }
+            _113644C = _11360CC;
+            _1135FAE = StationId::null;
+        };
+        walk(getSegment(network, pos, trackAndDirection));
+
+        _1136430 = distance;
+        _113642C--;
+    }
+
+    // 0x004ACBFF
+    static void walkLongest(const Network& network, const World::Pos3& pos, const uint16_t trackAndDirection)
+    {
+        if (_113642C >= kMaxDepth)
+        {
+            return;
+        }
+        _113642C++;
+        const uint32_t distance = _1136430;
+
+        const auto walk = [&network](const Segment& segment) {
+            for (const auto& piece : segment.pieces)
+            {
+                if (piece.trackAndDirection & AdditionalTaDFlags::hasSignal)
+                {
+                    const auto tad = toTad(piece.trackAndDirection);
+                    if (getSignalState(piece.pos, tad, network.trackType, 0xA) & (1 << 0))
+                    {
+                        return;
+                    }
+                    if (getSignalState(piece.pos, tad, network.trackType, 0x8000000A) & (1 << 1))
+                    {
+                        return;
+                    }
+                }
+                if (!walkPiece(segment, piece))
+                {
+                    return;
+                }
+                _1136434 = std::max<uint32_t>(_1136434, _1136430);
+            }
+            if (segment.junction.size == 0)
+            {
+                return;
+            }
+            const auto junctionPos = segment.junctionPos;
+            const auto junction = segment.junction;
+            for (uint32_t i = 0; i < junction.size; ++i)
+            {
+                walkLongest(network, junctionPos, junction.data[i]);
+            }
+            _1135FAE = StationId::null;
+        };
+        walk(getSegment(network, pos, trackAndDirection));
+
+        _1136430 = distance;
+        _113642C--;
+    }
+
+    static Network getNetwork(const VehicleHead& head)
+    {
+        return Network{ head.owner, head.trackType, _113601A[0] };
+    }
+
+    // Last of the highest, as the original
+    template<typename T>
+    static uint32_t getBestIndex(const std::array<T, 16>& ratings, const uint32_t count)
+    {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < count; ++i)
+        {
+            if (ratings[i] >= ratings[best])
+            {
+                best = i;
+            }
+        }
+        return best;
+    }
+
+    static uint16_t chooseConnectionBySignals(const Network& network, const World::Pos3& pos, const TrackConnections& connections)
+    {
+        _113642C = 0;
+        _1136430 = 0;
+
+        std::array<uint16_t, 16> ratings{};
+        for (uint32_t i = 0; i < connections.size; ++i)
+        {
+            _113642E = 0;
+            walkRatingSignals(network, pos, connections.data[i] & AdditionalTaDFlags::basicTaDWithSignalMask);
+            ratings[i] = kSignalsSeenRating[_113642E] + (_1136438 & 0x7);
+            _1136438 = std::rotr<uint32_t>(_1136438, 3);
+        }
+        return connections.data[getBestIndex(ratings, connections.size)];
+    }
+
+    // Whether the route just walked is better than the best one so far
+    static bool isBetterRoute()
+    {
+        if (_1136450 == kNoBestRoute)
+        {
+            return true;
+        }
+
+        // Routes that get closer to the target without reaching it rate after those that do
+        const uint32_t rating = _113644C + (_1136448 != 0 ? 0x100 : 0);
+        const uint32_t bestRating = _1136450 + (_1136456 != 0 ? 0x100 : 0);
+
+        if (rating == 3 && bestRating <= 2 && _113643C > 0x120 && (_1136444 * 5) >> 2 <= _113643C)
+        {
+            return true;
+        }
+        if (bestRating == 3 && rating <= 2 && _1136444 > 0x120 && (_113643C * 5) >> 2 <= _1136444)
+        {
+            return false;
+        }
+        if (rating == 0x103 && bestRating == 0x102)
+        {
+            if (static_cast<uint16_t>((_1136448 * 5) >> 2) <= _1136456 || static_cast<uint16_t>(_1136448 + 0x140) <= _1136456)
+            {
+                return true;
+            }
+        }
+        if (bestRating == 0x103 && rating == 0x102)
+        {
+            if (static_cast<uint16_t>((_1136456 * 5) >> 2) <= _1136448 || static_cast<uint16_t>(_1136456 + 0x140) <= _1136448)
+            {
+                return false;
+            }
+        }
+        if (rating != bestRating)
+        {
+            return rating < bestRating;
+        }
+        if (_1136448 != _1136456)
+        {
+            return _1136448 < _1136456;
+        }
+        return _1136444 <= _113643C;
+    }
+
+    static uint16_t chooseConnectionTowardsTarget(const Network& network, const World::Pos3& pos, const TrackConnections& connections)
+    {
+        _113642C = 0;
+        _1136430 = 0;
+
+        for (uint32_t i = 0; i < connections.size; ++i)
+        {
+            const auto connection = connections.data[i];
+            if (_113644A == StationId::null && isTargetWaypoint(pos, connection))
+            {
+                _1136450 = 1;
+                _1136456 = 0;
+                _113643C = 0;
+                _1136458 = 1;
+                return connection;
+            }
+
+            _113644C = kNoRating;
+            _1136448 = 0xFFFF;
+            _1136444 = 0xFFFFFFFFU;
+            _1135FAE = StationId::null;
+            walkTowardsTarget(network, pos, connection & AdditionalTaDFlags::basicTaDWithSignalMask);
+            if (_113644C == kNoRating)
+            {
+                _113644C = 2;
+            }
+
+            if (isBetterRoute())
+            {
+                _1136450 = _113644C;
+                _1136456 = _1136448;
+                _113643C = _1136444;
+                _1136440 = i;
+                _1136458 = 1;
+            }
+        }
+        return connections.data[_1136440];
+    }
+
+    static uint16_t chooseConnectionNative(VehicleHead& head, const World::Pos3& pos, bool isTail, const TrackConnections& connections)
+    {
+        evictSegmentsIfFull();
+        if (!isTail)
+        {
+            _1136450 = kNoBestRoute;
+        }
+        _1136438 = Tutorial::state() == Tutorial::State::none ? gPrng1().randNext() : 0;
+
+        OrderRingView orders(head.orderTableOffset, head.currentOrder);
+        const auto& order = *orders.begin();
+        if (const auto* waypoint = order.as<OrderRouteWaypoint>())
+        {
+            _113644A = StationId::null;
+
+            // The waypoint can be passed in either direction
+            const auto waypointPos = waypoint->getWaypoint();
+            const uint16_t rawTad = waypoint->_data[3] | (waypoint->_data[4] << 8);
+            const uint16_t tad = rawTad & AdditionalTaDFlags::basicTaDMask;
+            _113645A = waypointPos;
+            _1136460 = rawTad;
+
+            const auto& trackSize = World::TrackData::getUnkTrack(tad);
+            auto reversePos = waypointPos + trackSize.pos;
+            if (trackSize.rotationEnd < 12)
+            {
+                reversePos -= World::Pos3{ World::kRotationOffset[trackSize.rotationEnd], 0 };
+            }
+            _1136462 = reversePos;
+            _1136468 = tad ^ (1 << 2);
+        }
+        else if (const auto* stationOrder = order.as<OrderStation>())
+        {
+            _113644A = stationOrder->getStation();
+            const auto* station = StationManager::get(stationOrder->getStation());
+            _113645A = World::Pos3(station->x, station->y, station->z);
+        }
+        else
+        {
+            return chooseConnectionBySignals(getNetwork(head), pos, connections);
+        }
+        return chooseConnectionTowardsTarget(getNetwork(head), pos, connections);
+    }
+
+    static uint16_t chooseLongestConnectionNative(VehicleHead& head, const World::Pos3& pos, const TrackConnections& connections)
+    {
+        evictSegmentsIfFull();
+        const auto network = getNetwork(head);
+        _113642C = 0;
+        _1136430 = 0;
+
+        std::array<uint32_t, 16> lengths{};
+        for (uint32_t i = 0; i < connections.size; ++i)
+        {
+            _1136434 = 0;
+            walkLongest(network, pos, connections.data[i] & AdditionalTaDFlags::basicTaDWithSignalMask);
+            lengths[i] = _1136434;
+        }
+        return connections.data[getBestIndex(lengths, connections.size)];
+    }
+
+    // Everything the route choice reads or leaves behind
+    struct WalkState
+    {
+        std::array<uint8_t, 0x3E> walk;
+        uint32_t bestRating;
+        StationId station;
+        uint8_t levelCrossing;
+        uint32_t rng0;
+        uint32_t rng1;
+
+        bool operator==(const WalkState& rhs) const = default;
+    };
+
+    static WalkState captureWalkState()
+    {
+        WalkState state{};
+        std::memcpy(state.walk.data(), _walkState.get(), state.walk.size());
+        state.bestRating = _11360CC;
+        state.station = _1135FAE;
+        state.levelCrossing = _113607D;
+        state.rng0 = gPrng1().srand_0();
+        state.rng1 = gPrng1().srand_1();
+        return state;
+    }
+
+    static void restoreWalkState(const WalkState& state)
+    {
+        std::memcpy(_walkState.get(), state.walk.data(), state.walk.size());
+        _11360CC = state.bestRating;
+        _1135FAE = state.station;
+        _113607D = state.levelCrossing;
+        gPrng1() = Core::Prng(state.rng0, state.rng1);
+    }
+
+    // Runs the original and then the native route choice from the same state, keeping the original's
+    template<typename TOriginal, typename TNative>
+    static uint16_t compareWithOriginal(const VehicleHead& head, const World::Pos3& pos, TOriginal&& original, TNative&& native)
+    {
+        const auto before = captureWalkState();
+        const auto originalResult = original();
+        const auto originalState = captureWalkState();
+
+        restoreWalkState(before);
+        const auto result = native();
+        if (result != originalResult || captureWalkState() != originalState)
+        {
+            Logging::error("Route choice for vehicle {} at {}, {}, {} differs from the original: {:#06x} instead of {:#06x}", enumValue(head.id), pos.x, pos.y, pos.z, result, originalResult);
+            _mismatches++;
+            restoreWalkState(originalState);
+            return originalResult;
+        }
+        return result;
+    }
+
+    uint16_t chooseConnection(VehicleHead& head, const World::Pos3& pos, bool isTail, const TrackConnections& connections)
+    {
+        if (!_compareWithOriginal)
+        {
+            return chooseConnectionNative(head, pos, isTail, connections);
+        }
+        const auto original = [&]() {
+            _113609C = connections;
+            registers regs;
+            regs.ax = pos.x;
+            regs.cx = pos.y;
+            regs.dx = pos.z;
+            regs.esi = X86Pointer(&head);
+            // Entered past the hook, 0x004AC3E4 keeps the head's choice for the tail
+            call(isTail ? 0x004AC3E4 : 0x004AC3DA, regs);
+            return static_cast<uint16_t>(regs.ebx);
+        };
+        const auto native = [&]() { return chooseConnectionNative(head, pos, isTail, connections); };
+        return compareWithOriginal(head, pos, original, native);
+    }
+
+    uint16_t chooseLongestConnection(VehicleHead& head, const World::Pos3& pos, const TrackConnections& connections)
+    {
+        if (!_compareWithOriginal)
+        {
+            return chooseLongestConnectionNative(head, pos, connections);
+        }
+        // The hook covers the start of 0x004AC34D so only its walk can be run
+        const auto original = [&]() {
+            _113642C = 0;
+            _1136430 = 0;
+            std::array<uint32_t, 16> lengths{};
+            for (uint32_t i = 0; i < connections.size; ++i)
+            {
+                _1136434 = 0;
+                registers regs;
+                regs.ax = pos.x;
+                regs.cx = pos.y;
+                regs.dx = pos.z;
+                regs.bl = enumValue(head.owner);
+                regs.bh = head.trackType;
+                regs.ebp = connections.data[i] & AdditionalTaDFlags::basicTaDWithSignalMask;
+                call(0x004ACBFF, regs);
+                lengths[i] = _1136434;
+            }
+            return connections.data[getBestIndex(lengths, connections.size)];
+        };
+        const auto native = [&]() { return chooseLongestConnectionNative(head, pos, connections); };
+        return compareWithOriginal(head, pos, original, native);
+    }
+
+    void setCompareWithOriginal(bool compare)
+    {
+        _compareWithOriginal = compare;
+        _mismatches = 0;
+    }
+
+    bool verify()
+    {
+        return _mismatches == 0;
+    }
+
+    void registerHooks()
+    {
+        registerHook(
+            0x004AC3D3,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                VehicleHead* head = X86Pointer<VehicleHead>(regs.esi);
+                const bool isTail = (regs.dx & 0x8000) != 0;
+                const World::Pos3 pos(regs.ax, regs.cx, regs.dx & 0x7FFF);
+                const auto connection = chooseConnection(*head, pos, isTail, _113609C);
+                regs = backup;
+                regs.dx &= 0x7FFF;
+                regs.ebx = connection;
+                return 0;
+            });
+
+        registerHook(
+            0x004AC34D,
+            [](registers& regs) FORCE_ALIGN_ARG_POINTER -> uint8_t {
+                registers backup = regs;
+                VehicleHead* head = X86Pointer<VehicleHead>(regs.esi);
+                const World::Pos3 pos(regs.ax, regs.cx, regs.dx);
+                const auto connection = chooseLongestConnection(*head, pos, _113609C);
+                regs = backup;
+                regs.ebx = connection;
+                return 0;
+            });
+    }
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Map/Track/Track.h"
+#include <OpenLoco/Engine/World.hpp>
+
+namespace OpenLoco::Vehicles
+{
+    struct VehicleHead;
+}
+
+/**
+ * Route choice for trains reaching a junction (0x004AC3D3 and 0x004AC34D). The original walks the
+ * track tile by tile for every candidate route, here the track between two junctions is looked up
+ * once and kept as a graph of segments. Signals are still read as the walk reaches them so only
+ * changes to track, signals, stations or track mods (all game commands) drop segments.
+ */
+namespace OpenLoco::Vehicles::TrackPathfinding
+{
+    void registerHooks();
+
+    void invalidate(const World::Pos2& pos);
+    void invalidateAll();
+
+    // 0x004AC3D3
+    // Picks one of the connections for the head to head for. The tail is asked after the head and
+    // only replaces the head's choice when it finds a better route. Sets 0x01136458 when the route
+    // was chosen by distance to the order's station or waypoint.
+    uint16_t chooseConnection(VehicleHead& head, const World::Pos3& pos, bool isTail, const World::Track::TrackConnections& connections);
+
+    // 0x004AC34D
+    // Picks the connection with the most free track beyond it.
+    uint16_t chooseLongestConnection(VehicleHead& head, const World::Pos3& pos, const World::Track::TrackConnections& connections);
+
+    // Runs the original route choice alongside and logs any difference in the result or the state
+    // it leaves behind, the original's choice is used when they differ.
+    void setCompareWithOriginal(bool compare);
+    // False when any route choice differed from the original since comparing was enabled.
+    bool verify();
+}
@@ -185,6 +185,9 @@ namespace OpenLoco::Vehicles
     uint8_t getSignalState(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const uint8_t trackType, uint32_t flags);
     void sub_4A2AD7(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
     uint8_t sub_4A2A58(const World::Pos3& loc, const TrackAndDirection::_TrackAndDirection trackAndDirection, const CompanyId company, const uint8_t trackType);
+    // Signal blocks walked by the above are cached, these must be called when track or signal elements change
+    void invalidateSignalBlocks(const World::Pos2& pos);
+    void invalidateAllSignalBlocks();
     struct ApplyTrackModsResult
     {
         currency32_t cost;
@@ -30,6 +30,8 @@
 #include "Random.h"
 #include "ScenarioManager.h"
 #include "SceneManager.h"
+#include "TrackOccupancy.h"
+#include "TrackPathfinding.h"
 #include "Ui/WindowManager.h"
 #include "Vehicle.h"
 #include "VehicleManager.h"
@@ -3333,17 +3335,9 @@ namespace OpenLoco::Vehicles
             auto reverseTad = tad;
             reverseTad.setReversed(!tad.isReversed());
 
-            for (auto* v : VehicleManager::VehicleList())
+            if (TrackOccupancy::findVehicle(pos, reverseTad) != nullptr)
             {
-                Vehicle vehicle(v->head);
-                auto* veh2 = vehicle.veh2;
-                if (veh2->tileX == pos.x
-                    && veh2->tileY == pos.y
-                    && veh2->tileBaseZ == pos.z / World::kSmallZStep
-                    && veh2->trackAndDirection.track == reverseTad)
-                {
-                    return true;
-                }
+                return true;
             }
         }
         return false;
@@ -3371,12 +3365,7 @@ namespace OpenLoco::Vehicles
         static loco_global<World::Track::TrackConnections, 0x0113609C> _113609C;
         _113609C = connections;
 
-        registers regs;
-        regs.ax = pos.x;
-        regs.cx = pos.y;
-        regs.dx = pos.z | (unk ? 0x8000 : 0);
-        regs.esi = X86Pointer(&head);
-        call(0x004AC3D3, regs);
+        TrackPathfinding::chooseConnection(head, pos, unk, connections);
     }
 
     // 0x004ACCE6
@@ -12,11 +12,14 @@
 #include "Orders.h"
 #include "RoutingManager.h"
 #include "SceneManager.h"
+#include "TrackOccupancy.h"
 #include "Ui/WindowManager.h"
 #include "Vehicle.h"
 #include "World/Company.h"
 #include "World/CompanyManager.h"
+#include "World/CompanyOwnership.h"
 
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 using namespace OpenLoco::Interop;
@@ -26,11 +29,16 @@ namespace OpenLoco::VehicleManager
     // 0x004A8826
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("VehicleManager::update");
+
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !isEditorMode())
         {
             for (auto* v : VehicleList())
             {
+                // The vehicle may delete itself while updating
+                const auto id = v->id;
                 v->updateVehicle();
+                Vehicles::TrackOccupancy::refresh(id);
             }
         }
     }
@@ -241,6 +249,7 @@ namespace OpenLoco::VehicleManager
         Vehicles::OrderManager::freeOrders(&head);
         MessageManager::removeAllSubjectRefs(enumValue(head.id), MessageItemArgumentType::vehicle);
         const auto companyId = head.owner;
+        CompanyOwnership::removeVehicle(head);
         EntityManager::freeEntity(train.tail);
         EntityManager::freeEntity(train.veh2);
         EntityManager::freeEntity(train.veh1);
@@ -10,6 +10,7 @@
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
 #include "Paint/Paint.h"
+#include "Paint/PaintPickBuffer.h"
 #include "SceneManager.h"
 #include "Ui/ViewportInteraction.h"
 #include "Ui/WindowManager.h"
@@ -20,6 +21,7 @@
 #include "World/CompanyManager.h"
 #include "World/StationManager.h"
 #include "World/TownManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 using namespace OpenLoco::Interop;
@@ -242,6 +244,8 @@ namespace OpenLoco::Ui
     // 0x0045A1A4
     void Viewport::paint(Gfx::RenderTarget* rt, const Rect& rect)
     {
+        OPENLOCO_PROFILE_SCOPE("Viewport::paint");
+
         Paint::SessionOptions options{};
         if (hasFlags(ViewportFlags::seeThroughScenery | ViewportFlags::seeThroughTracks))
         {
@@ -255,6 +259,7 @@ namespace OpenLoco::Ui
         }
         options.rotation = getRotation();
         options.viewFlags = flags;
+        options.cacheStaticLayer = true;
 
         const uint32_t bitmask = 0xFFFFFFFF << zoom;
 
@@ -315,7 +320,9 @@ namespace OpenLoco::Ui
             auto* sess = Paint::allocateSession(columnRt, options);
             sess->generate();
             sess->arrangeStructs();
+            Paint::PickBuffer::beginRegion(columnRt, *this);
             sess->drawStructs();
+            Paint::PickBuffer::endRegion();
             // Climate code used to draw here.
 
             if (!isTitleMode())
@@ -5,6 +5,7 @@
 #include "Map/MapSelection.h"
 #include "Map/Tile.h"
 #include "Map/TileManager.h"
+#include "Paint/Paint.h"
 #include "Ui/ViewportInteraction.h"
 #include "Ui/WindowManager.h"
 #include "Window.h"
@@ -318,6 +319,8 @@ namespace OpenLoco::Ui::ViewportManager
 
     void invalidate(const World::Pos2 pos, coord_t zMin, coord_t zMax, ZoomLevel zoom, int radius)
     {
+        Paint::markTileModified(pos);
+
         auto axbx = World::gameToScreen(World::Pos3(pos.x + 16, pos.y + 16, zMax), WindowManager::getCurrentRotation());
         axbx.x -= radius;
         axbx.y -= radius;
@@ -11,6 +11,7 @@
 #include "Localisation/StringIds.h"
 #include "Logging.h"
 #include "OpenLoco.h"
+#include "S5/PreviewCache.h"
 #include "S5/S5.h"
 #include "Scenario.h"
 #include "Ui.h"
@@ -179,6 +180,7 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
     {
         _files.clear();
         freeFileDetails();
+        S5::PreviewCache::save();
     }
 
     // 0x004467F6
@@ -915,10 +917,10 @@ namespace OpenLoco::Ui::Windows::PromptBrowse
         switch (_fileType)
         {
             case BrowseFileType::savedGame:
-                _previewSaveDetails = S5::readSaveDetails(path);
+                _previewSaveDetails = S5::PreviewCache::getSaveDetails(path);
                 break;
             case BrowseFileType::landscape:
-                _previewScenarioOptions = S5::readScenarioOptions(path);
+                _previewScenarioOptions = S5::PreviewCache::getScenarioOptions(path);
                 break;
         }
     }
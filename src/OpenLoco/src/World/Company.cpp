@@ -1,5 +1,6 @@
 #include "Company.h"
 #include "CompanyManager.h"
+#include "CompanyOwnership.h"
 #include "Entities/EntityManager.h"
 #include "GameCommands/Company/ChangeLoan.h"
 #include "GameCommands/GameCommands.h"
@@ -23,7 +24,6 @@
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
-#include "Vehicles/VehicleManager.h"
 #include "ViewportManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
 #include <OpenLoco/Interop/Interop.hpp>
@@ -52,12 +52,9 @@ namespace OpenLoco
         }
 
         auto companyId = id();
-        for (auto* v : VehicleManager::VehicleList())
+        for (auto* v : CompanyOwnership::getVehicles(companyId))
         {
-            if (v->owner == companyId)
-            {
-                transportTypeCount[enumValue(v->vehicleType)]++;
-            }
+            transportTypeCount[enumValue(v->vehicleType)]++;
         }
 
         Ui::WindowManager::invalidate(Ui::WindowType::company, enumValue(companyId));
@@ -270,12 +267,8 @@ namespace OpenLoco
     // 0x004B8ED2
     void Company::updateVehicleColours()
     {
-        for (auto* v : VehicleManager::VehicleList())
+        for (auto* v : CompanyOwnership::getVehicles(id()))
         {
-            if (v->owner != id())
-            {
-                continue;
-            }
             Vehicles::Vehicle train(*v);
             for (auto& car : train.cars)
             {
@@ -1,6 +1,7 @@
 #include "CompanyAi.h"
 #include "Company.h"
 #include "CompanyManager.h"
+#include "CompanyOwnership.h"
 #include "Date.h"
 #include "GameCommands/Airports/CreateAirport.h"
 #include "GameCommands/Airports/RemoveAirport.h"
@@ -870,23 +871,18 @@ namespace OpenLoco
     }
 
     // 0x004884E7
-    // returns false until the whole map has been iterated
+    // returns false until every tile with the company's track or road has been visited
     static bool removeAllCompanyAssetsOnMapByChunk(Company& company)
     {
-        auto remainingRange = World::TilePosRangeView(
-            World::toTileSpace(company.var_85C4),
-            World::TilePos2{ World::kMapColumns - 1, World::kMapRows - 1 });
+        // Vanilla swept the whole map, only the tiles the company has built on are visited now
+        // (still in the same order) so this no longer takes ~100 ticks regardless of its size.
+        const auto remainingTiles = CompanyOwnership::getTrackAndRoadTiles(company.id(), World::toTileSpace(company.var_85C4));
 
         auto count = 1500;
-        for (auto& tilePos : remainingRange)
+        for (auto& tilePos : remainingTiles)
         {
             removeCompanyTracksRoadsOnTile(company.id(), tilePos);
             count--;
-            // TODO: Remove when divergence from vanilla as this is silly
-            if (tilePos.x == World::kMapColumns - 1)
-            {
-                count--;
-            }
             if (count == 0)
             {
                 company.var_85C4 = World::toWorldSpace(tilePos);
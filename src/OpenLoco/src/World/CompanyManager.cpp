@@ -34,6 +34,7 @@
 #include "Ui/WindowManager.h"
 #include "Vehicles/Vehicle.h"
 #include "Vehicles/VehicleManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 using namespace OpenLoco::Interop;
@@ -208,6 +209,8 @@ namespace OpenLoco::CompanyManager
     // 0x00430319
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("CompanyManager::update");
+
         if (!isEditorMode() && !Config::get().companyAIDisabled)
         {
             CompanyId id = CompanyId(ScenarioManager::getScenarioTicks() & 0x0F);
@@ -0,0 +1,260 @@
+#include "CompanyOwnership.h"
+#include "Engine/Limits.h"
+#include "Entities/EntityManager.h"
+#include "Logging.h"
+#include "Map/RoadElement.h"
+#include "Map/TileLoop.hpp"
+#include "Map/TileManager.h"
+#include "Map/TrackElement.h"
+#include "Vehicles/Vehicle.h"
+#include "Vehicles/VehicleManager.h"
+#include <algorithm>
+#include <array>
+#include <set>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::CompanyOwnership
+{
+    // Sorted by row then column, the same order TilePosRangeView visits them in
+    using TileKey = uint32_t;
+
+    struct CompanyAssets
+    {
+        std::vector<EntityId> vehicles;
+        std::set<TileKey> tiles;
+    };
+
+    static std::array<CompanyAssets, Limits::kMaxCompanies> _assets;
+    static bool _isValid = false;
+
+    static constexpr TileKey toKey(const World::TilePos2& pos)
+    {
+        return (static_cast<TileKey>(pos.y) << 16) | static_cast<uint16_t>(pos.x);
+    }
+
+    static constexpr World::TilePos2 fromKey(TileKey key)
+    {
+        return World::TilePos2(static_cast<tile_coord_t>(key & 0xFFFF), static_cast<tile_coord_t>(key >> 16));
+    }
+
+    static CompanyAssets* getAssets(CompanyId id)
+    {
+        const auto index = enumValue(id);
+        return index < _assets.size() ? &_assets[index] : nullptr;
+    }
+
+    static CompanyId getTrackOrRoadOwner(const World::TileElement& el)
+    {
+        if (const auto* elTrack = el.as<World::TrackElement>())
+        {
+            return elTrack->owner();
+        }
+        if (const auto* elRoad = el.as<World::RoadElement>())
+        {
+            return elRoad->owner();
+        }
+        return CompanyId::null;
+    }
+
+    static bool hasTrackOrRoad(CompanyId id, const World::TilePos2& pos)
+    {
+        const auto tile = World::TileManager::get(pos);
+        return std::any_of(tile.begin(), tile.end(), [id](const World::TileElement& el) { return getTrackOrRoadOwner(el) == id; });
+    }
+
+    static void rebuild()
+    {
+        for (auto& assets : _assets)
+        {
+            assets.vehicles.clear();
+            assets.tiles.clear();
+        }
+
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            if (auto* assets = getAssets(head->owner))
+            {
+                assets->vehicles.push_back(head->id);
+            }
+        }
+
+        for (const auto& pos : World::getWorldRange())
+        {
+            const auto tile = World::TileManager::get(pos);
+            for (const auto& el : tile)
+            {
+                const auto owner = getTrackOrRoadOwner(el);
+                if (auto* assets = getAssets(owner))
+                {
+                    assets->tiles.insert(toKey(pos));
+                }
+            }
+        }
+        _isValid = true;
+    }
+
+    static CompanyAssets* getValidAssets(CompanyId id)
+    {
+        if (!_isValid)
+        {
+            rebuild();
+        }
+        return getAssets(id);
+    }
+
+    void invalidate()
+    {
+        _isValid = false;
+    }
+
+    void addVehicle(const Vehicles::VehicleHead& head)
+    {
+        // Will be picked up by the rebuild
+        if (!_isValid)
+        {
+            return;
+        }
+        if (auto* assets = getAssets(head.owner))
+        {
+            assets->vehicles.push_back(head.id);
+        }
+    }
+
+    void removeVehicle(const Vehicles::VehicleHead& head)
+    {
+        if (!_isValid)
+        {
+            return;
+        }
+        if (auto* assets = getAssets(head.owner))
+        {
+            auto& vehicles = assets->vehicles;
+            vehicles.erase(std::remove(vehicles.begin(), vehicles.end(), head.id), vehicles.end());
+        }
+    }
+
+    std::vector<Vehicles::VehicleHead*> getVehicles(CompanyId id)
+    {
+        std::vector<Vehicles::VehicleHead*> heads;
+        const auto* assets = getValidAssets(id);
+        if (assets == nullptr)
+        {
+            return heads;
+        }
+
+        heads.reserve(assets->vehicles.size());
+        for (const auto vehId : assets->vehicles)
+        {
+            auto* component = EntityManager::get<Vehicles::VehicleBase>(vehId);
+            auto* head = component != nullptr ? component->asVehicleHead() : nullptr;
+            if (head != nullptr && head->owner == id)
+            {
+                heads.push_back(head);
+            }
+        }
+        return heads;
+    }
+
+    void addTile(CompanyId id, const World::TilePos2& pos)
+    {
+        if (!_isValid)
+        {
+            return;
+        }
+        // A piece built over someone else's road keeps their ownership
+        auto* assets = getAssets(id);
+        if (assets != nullptr && hasTrackOrRoad(id, pos))
+        {
+            assets->tiles.insert(toKey(pos));
+        }
+    }
+
+    void removeTile(CompanyId id, const World::TilePos2& pos)
+    {
+        if (!_isValid)
+        {
+            return;
+        }
+        auto* assets = getAssets(id);
+        if (assets != nullptr && !hasTrackOrRoad(id, pos))
+        {
+            assets->tiles.erase(toKey(pos));
+        }
+    }
+
+    std::vector<World::TilePos2> getTrackAndRoadTiles(CompanyId id, const World::TilePos2& from)
+    {
+        std::vector<World::TilePos2> tiles;
+        auto* assets = getValidAssets(id);
+        if (assets == nullptr)
+        {
+            return tiles;
+        }
+
+        // Stale entries are dropped here so the result only depends on the map, the same as
+        // from an index that has just been rebuilt.
+        for (auto it = assets->tiles.lower_bound(toKey(from)); it != assets->tiles.end();)
+        {
+            const auto pos = fromKey(*it);
+            if (!hasTrackOrRoad(id, pos))
+            {
+                it = assets->tiles.erase(it);
+                continue;
+            }
+            tiles.push_back(pos);
+            ++it;
+        }
+        return tiles;
+    }
+
+    bool verify()
+    {
+        if (!_isValid)
+        {
+            rebuild();
+            return true;
+        }
+
+        bool matches = true;
+        std::array<size_t, Limits::kMaxCompanies> numVehicles{};
+        for (auto* head : VehicleManager::VehicleList())
+        {
+            const auto* assets = getAssets(head->owner);
+            if (assets == nullptr)
+            {
+                continue;
+            }
+            numVehicles[enumValue(head->owner)]++;
+            if (std::find(assets->vehicles.begin(), assets->vehicles.end(), head->id) == assets->vehicles.end())
+            {
+                Logging::error("Vehicle {} of company {} is missing from the ownership index", enumValue(head->id), enumValue(head->owner));
+                matches = false;
+            }
+        }
+        for (size_t i = 0; i < _assets.size(); i++)
+        {
+            if (_assets[i].vehicles.size() != numVehicles[i])
+            {
+                Logging::error("Ownership index lists {} vehicles for company {}, it has {}", _assets[i].vehicles.size(), i, numVehicles[i]);
+                matches = false;
+            }
+        }
+
+        for (const auto& pos : World::getWorldRange())
+        {
+            const auto tile = World::TileManager::get(pos);
+            for (const auto& el : tile)
+            {
+                const auto owner = getTrackOrRoadOwner(el);
+                const auto* assets = getAssets(owner);
+                if (assets != nullptr && !assets->tiles.contains(toKey(pos)))
+                {
+                    Logging::error("Track or road of company {} at {}, {} is missing from the ownership index", enumValue(owner), pos.x, pos.y);
+                    matches = false;
+                }
+            }
+        }
+        return matches;
+    }
+}
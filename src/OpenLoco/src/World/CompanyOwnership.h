@@ -0,0 +1,41 @@
+#pragma once
+
+#include "Types.hpp"
+#include <OpenLoco/Engine/World.hpp>
+#include <vector>
+
+namespace OpenLoco::Vehicles
+{
+    struct VehicleHead;
+}
+
+/**
+ * Index of what each company owns so operations on a single company cost time proportional
+ * to its assets rather than to the size of the map or the whole fleet.
+ *
+ * Vehicles are listed exactly. Tiles are a superset: every tile with a track or road piece owned
+ * by the company is listed, but a tile may stay listed after its last piece has been removed
+ * by something other than a game command. Such tiles are never handed out, so what callers see
+ * is the same as from an index freshly built from the map. The index is built on first use after
+ * a game has been loaded.
+ */
+namespace OpenLoco::CompanyOwnership
+{
+    void invalidate();
+
+    void addVehicle(const Vehicles::VehicleHead& head);
+    void removeVehicle(const Vehicles::VehicleHead& head);
+    std::vector<Vehicles::VehicleHead*> getVehicles(CompanyId id);
+
+    // Only remembers the tile if the company owns a track or road piece on it.
+    void addTile(CompanyId id, const World::TilePos2& pos);
+    // Only forgets the tile once the company has no track or road left on it.
+    void removeTile(CompanyId id, const World::TilePos2& pos);
+    // Tiles that have the company's track or road on them, in the order a sweep over the map
+    // would visit them, starting at the given tile.
+    std::vector<World::TilePos2> getTrackAndRoadTiles(CompanyId id, const World::TilePos2& from);
+
+    // Compares the index with a scan of the map and every vehicle, logs and returns false if
+    // anything is missing from it. An index that has been thrown away is rebuilt instead.
+    bool verify();
+}
@@ -4,6 +4,7 @@
 #include "GameCommands/Industries/RemoveIndustry.h"
 #include "GameCommands/Terraform/CreateWall.h"
 #include "IndustryManager.h"
+#include "IndustrySurfaces.h"
 #include "Localisation/Formatting.h"
 #include "Localisation/StringIds.h"
 #include "Map/AnimationManager.h"
@@ -144,18 +145,28 @@ namespace OpenLoco
     {
         if (!hasFlags(IndustryFlags::isGhost) && under_construction == 0xFF)
         {
-            // Run tile loop for 100 iterations
+            // Run tile loop for 100 iterations, only the tiles claimed by the industry can count
+            const auto from = toTileSpace(tileLoop.current());
+            bool hasFinishedLoop = false;
             for (int i = 0; i < 100; i++)
             {
-                sub_45329B(tileLoop.current());
-
                 // loc_453318
                 if (tileLoop.next() == Pos2())
                 {
-                    sub_453354();
+                    hasFinishedLoop = true;
                     break;
                 }
             }
+
+            const auto to = hasFinishedLoop ? TilePos2(0, kMapRows) : toTileSpace(tileLoop.current());
+            for (const auto& tilePos : IndustrySurfaces::getClaimedSurfaces(id(), from, to))
+            {
+                sub_45329B(toWorldSpace(tilePos));
+            }
+            if (hasFinishedLoop)
+            {
+                sub_453354();
+            }
         }
     }
 
@@ -519,6 +530,7 @@ namespace OpenLoco
         World::SurfaceElement* surface = tile.surface();
         surface->setIsIndustrialFlag(true);
         surface->setIndustry(industryId);
+        IndustrySurfaces::add(industryId, pos);
         surface->setVar5SLR5((var_EA & 0xE0) >> 5);
         surface->setVar6SLR5((var_EA & 0x7));
         Ui::ViewportManager::invalidate(World::toWorldSpace(pos), surface->baseHeight(), surface->baseHeight() + 32);
@@ -20,6 +20,7 @@
 #include "SceneManager.h"
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Math/Vector.hpp>
 #include <numeric>
 
@@ -85,6 +86,8 @@ namespace OpenLoco::IndustryManager
     // 0x00453234
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("IndustryManager::update");
+
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !isEditorMode())
         {
             CompanyManager::setUpdatingCompanyId(CompanyId::neutral);
@@ -450,6 +453,9 @@ namespace OpenLoco::IndustryManager
     // 0x0045979C & 0x00459949
     static void createNewIndustry(const uint8_t indObjId, const bool buildImmediately, const int32_t numAttempts)
     {
+        // The map does not change while looking for a location, only once an industry is placed
+        World::TileManager::NeighbourhoodScope neighbourhood(World::TileManager::NeighbourhoodKind::all);
+
         // Try find valid coordinates for this industry
         for (auto attempt = 0; attempt < numAttempts; ++attempt)
         {
@@ -472,6 +478,8 @@ namespace OpenLoco::IndustryManager
                 {
                     break;
                 }
+                // Placement may have got part of the way before failing
+                neighbourhood.invalidate();
             }
         }
     }
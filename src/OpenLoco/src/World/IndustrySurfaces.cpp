@@ -0,0 +1,141 @@
+#include "IndustrySurfaces.h"
+#include "Engine/Limits.h"
+#include "Logging.h"
+#include "Map/SurfaceElement.h"
+#include "Map/TileLoop.hpp"
+#include "Map/TileManager.h"
+#include <array>
+#include <set>
+
+using namespace OpenLoco::Diagnostics;
+
+namespace OpenLoco::IndustrySurfaces
+{
+    // Sorted by row then column, the same order TileLoop visits them in
+    using TileKey = uint32_t;
+
+    static std::array<std::set<TileKey>, Limits::kMaxIndustries> _claimedSurfaces;
+    static bool _isValid = false;
+
+    static constexpr TileKey toKey(const World::TilePos2& pos)
+    {
+        return (static_cast<TileKey>(pos.y) << 16) | static_cast<uint16_t>(pos.x);
+    }
+
+    static constexpr World::TilePos2 fromKey(TileKey key)
+    {
+        return World::TilePos2(static_cast<tile_coord_t>(key & 0xFFFF), static_cast<tile_coord_t>(key >> 16));
+    }
+
+    static std::set<TileKey>* getSurfaces(IndustryId id)
+    {
+        const auto index = enumValue(id);
+        return index < _claimedSurfaces.size() ? &_claimedSurfaces[index] : nullptr;
+    }
+
+    static const World::SurfaceElement* getIndustrialSurface(const World::TilePos2& pos)
+    {
+        const auto* surface = World::TileManager::get(pos).surface();
+        return surface != nullptr && surface->isIndustrial() ? surface : nullptr;
+    }
+
+    static void rebuild()
+    {
+        for (auto& surfaces : _claimedSurfaces)
+        {
+            surfaces.clear();
+        }
+
+        for (const auto& pos : World::getWorldRange())
+        {
+            const auto* surface = getIndustrialSurface(pos);
+            if (surface == nullptr)
+            {
+                continue;
+            }
+            if (auto* surfaces = getSurfaces(surface->industryId()))
+            {
+                surfaces->insert(toKey(pos));
+            }
+        }
+        _isValid = true;
+    }
+
+    void invalidate()
+    {
+        _isValid = false;
+    }
+
+    void add(IndustryId id, const World::TilePos2& pos)
+    {
+        // Will be picked up by the rebuild
+        if (!_isValid)
+        {
+            return;
+        }
+        if (auto* surfaces = getSurfaces(id))
+        {
+            surfaces->insert(toKey(pos));
+        }
+    }
+
+    void remove(IndustryId id, const World::TilePos2& pos)
+    {
+        if (!_isValid)
+        {
+            return;
+        }
+        if (auto* surfaces = getSurfaces(id))
+        {
+            surfaces->erase(toKey(pos));
+        }
+    }
+
+    std::vector<World::TilePos2> getClaimedSurfaces(IndustryId id, const World::TilePos2& from, const World::TilePos2& to)
+    {
+        if (!_isValid)
+        {
+            rebuild();
+        }
+
+        std::vector<World::TilePos2> tiles;
+        const auto* surfaces = getSurfaces(id);
+        if (surfaces == nullptr)
+        {
+            return tiles;
+        }
+
+        const auto end = surfaces->lower_bound(toKey(to));
+        for (auto it = surfaces->lower_bound(toKey(from)); it != end; ++it)
+        {
+            tiles.push_back(fromKey(*it));
+        }
+        return tiles;
+    }
+
+    bool verify()
+    {
+        if (!_isValid)
+        {
+            rebuild();
+            return true;
+        }
+
+        bool matches = true;
+        for (const auto& pos : World::getWorldRange())
+        {
+            const auto* surface = getIndustrialSurface(pos);
+            if (surface == nullptr)
+            {
+                continue;
+            }
+            const auto* surfaces = getSurfaces(surface->industryId());
+            if (surfaces != nullptr && !surfaces->contains(toKey(pos)))
+            {
+                Logging::error("Surface of industry {} at {}, {} is missing from the claimed surfaces", enumValue(surface->industryId()), pos.x, pos.y);
+                matches = false;
+            }
+        }
+        return matches;
+    }
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Types.hpp"
+#include <OpenLoco/Engine/World.hpp>
+#include <vector>
+
+/**
+ * The surface tiles each industry has claimed, so its periodic sweep of the map only has to look
+ * at those rather than every tile.
+ *
+ * A superset: a tile stays listed if its surface is given up by anything other than
+ * SurfaceElement::removeIndustry, the surface itself decides whether it still counts. The index is
+ * built on first use after a game has been loaded.
+ */
+namespace OpenLoco::IndustrySurfaces
+{
+    void invalidate();
+
+    void add(IndustryId id, const World::TilePos2& pos);
+    void remove(IndustryId id, const World::TilePos2& pos);
+    // Tiles that may have been claimed by the industry from the first tile up to, but not including,
+    // the last one, in the order a TileLoop visits them.
+    std::vector<World::TilePos2> getClaimedSurfaces(IndustryId id, const World::TilePos2& from, const World::TilePos2& to);
+
+    // Compares the index with a scan of the map, logs and returns false if any claimed surface is
+    // missing from it. An index that has been thrown away is rebuilt instead.
+    bool verify();
+}
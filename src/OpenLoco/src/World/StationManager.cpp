@@ -16,6 +16,7 @@
 #include "TownManager.h"
 #include "Ui/WindowManager.h"
 #include "Window.h"
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
 
 #include <bitset>
@@ -57,6 +58,8 @@ namespace OpenLoco::StationManager
     // 0x0048B1FA
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("StationManager::update");
+
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !isEditorMode())
         {
             const auto id = StationId(ScenarioManager::getScenarioTicks() & 0x3FF);
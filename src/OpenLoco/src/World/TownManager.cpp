@@ -3,6 +3,7 @@
 #include "Game.h"
 #include "GameState.h"
 #include "GameStateFlags.h"
+#include "Logging.h"
 #include "Map/BuildingElement.h"
 #include "Map/TileLoop.hpp"
 #include "Map/TileManager.h"
@@ -12,9 +13,13 @@
 #include "SceneManager.h"
 #include "Ui/WindowManager.h"
 #include <OpenLoco/Core/Numerics.hpp>
+#include <OpenLoco/Diagnostics/Profiling.h>
 #include <OpenLoco/Interop/Interop.hpp>
+#include <algorithm>
+#include <set>
 
 using namespace OpenLoco::Interop;
+using namespace OpenLoco::Diagnostics;
 
 namespace OpenLoco::TownManager
 {
@@ -73,6 +78,71 @@ namespace OpenLoco::TownManager
 
     static auto& rawTowns() { return getGameState().towns; }
 
+    // Row then column of each tile in the registry, which is only ever a superset of the tiles with
+    // buildings, the ones that are gone are dropped the next time the influence is reset.
+    static std::set<uint32_t> _buildingTiles;
+    static bool _isBuildingRegistryValid = false;
+
+    static constexpr uint32_t toBuildingTileKey(const World::TilePos2& pos)
+    {
+        return (static_cast<uint32_t>(pos.y) << 16) | static_cast<uint16_t>(pos.x);
+    }
+
+    static constexpr World::TilePos2 fromBuildingTileKey(uint32_t key)
+    {
+        return World::TilePos2(static_cast<tile_coord_t>(key & 0xFFFF), static_cast<tile_coord_t>(key >> 16));
+    }
+
+    static bool isTownBuilding(const World::BuildingElement& building)
+    {
+        return !building.isGhost() && !building.has_40() && building.multiTileIndex() == 0;
+    }
+
+    static bool hasTownBuilding(const World::TilePos2& tilePos)
+    {
+        const auto tile = World::TileManager::get(tilePos);
+        return std::any_of(tile.begin(), tile.end(), [](const World::TileElement& element) {
+            const auto* building = element.as<World::BuildingElement>();
+            return building != nullptr && isTownBuilding(*building);
+        });
+    }
+
+    // Returns false if there are no town buildings on the tile
+    static bool addBuildingsInfluence(const World::TilePos2& tilePos)
+    {
+        bool hasBuilding = false;
+        auto tile = World::TileManager::get(tilePos);
+        for (auto& element : tile)
+        {
+            auto* building = element.as<World::BuildingElement>();
+            if (building == nullptr || !isTownBuilding(*building))
+                continue;
+
+            hasBuilding = true;
+            auto objectId = building->objectId();
+            auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
+            auto producedQuantity = buildingObj->producedQuantity[0];
+            uint32_t population;
+            if (!building->isConstructed())
+            {
+                population = 0;
+            }
+            else
+            {
+                population = producedQuantity;
+            }
+            auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
+            if (town != nullptr)
+            {
+                if (buildingObj->var_AC != 0xFF)
+                {
+                    town->var_150[buildingObj->var_AC] += 1;
+                }
+            }
+        }
+        return hasBuilding;
+    }
+
     // 0x00497348
     void resetBuildingsInfluence()
     {
@@ -84,47 +154,59 @@ namespace OpenLoco::TownManager
             std::fill(std::begin(town.var_150), std::end(town.var_150), 0);
         }
 
-        for (const auto& tilePos : World::getWorldRange())
+        if (!_isBuildingRegistryValid)
         {
-            auto tile = World::TileManager::get(tilePos);
-            for (auto& element : tile)
+            _buildingTiles.clear();
+            for (const auto& tilePos : World::getWorldRange())
             {
-                auto* building = element.as<World::BuildingElement>();
-                if (building == nullptr)
-                    continue;
+                if (addBuildingsInfluence(tilePos))
+                {
+                    _buildingTiles.insert(toBuildingTileKey(tilePos));
+                }
+            }
+            _isBuildingRegistryValid = true;
+        }
+        else
+        {
+            for (auto it = _buildingTiles.begin(); it != _buildingTiles.end();)
+            {
+                it = addBuildingsInfluence(fromBuildingTileKey(*it)) ? std::next(it) : _buildingTiles.erase(it);
+            }
+        }
+        Gfx::invalidateScreen();
+    }
 
-                if (building->isGhost())
-                    continue;
+    void registerBuilding(const World::Pos2& loc)
+    {
+        // Will be picked up by the full scan
+        if (_isBuildingRegistryValid)
+        {
+            _buildingTiles.insert(toBuildingTileKey(World::toTileSpace(loc)));
+        }
+    }
 
-                if (building->has_40())
-                    continue;
+    void invalidateBuildingRegistry()
+    {
+        _isBuildingRegistryValid = false;
+    }
 
-                if (building->multiTileIndex() != 0)
-                    continue;
+    bool verifyBuildingRegistry()
+    {
+        if (!_isBuildingRegistryValid)
+        {
+            return true;
+        }
 
-                auto objectId = building->objectId();
-                auto* buildingObj = ObjectManager::get<BuildingObject>(objectId);
-                auto producedQuantity = buildingObj->producedQuantity[0];
-                uint32_t population;
-                if (!building->isConstructed())
-                {
-                    population = 0;
-                }
-                else
-                {
-                    population = producedQuantity;
-                }
-                auto* town = updateTownInfo(World::toWorldSpace(tilePos), population, producedQuantity, 0, 1);
-                if (town != nullptr)
-                {
-                    if (buildingObj->var_AC != 0xFF)
-                    {
-                        town->var_150[buildingObj->var_AC] += 1;
-                    }
-                }
+        bool matches = true;
+        for (const auto& tilePos : World::getWorldRange())
+        {
+            if (hasTownBuilding(tilePos) && !_buildingTiles.contains(toBuildingTileKey(tilePos)))
+            {
+                Logging::error("Town building at {}, {} is missing from the building registry", tilePos.x, tilePos.y);
+                matches = false;
             }
         }
-        Gfx::invalidateScreen();
+        return matches;
     }
 
     // 0x00496B38
@@ -154,6 +236,8 @@ namespace OpenLoco::TownManager
     // 0x00496B6D
     void update()
     {
+        OPENLOCO_PROFILE_SCOPE("TownManager::update");
+
         if (Game::hasFlags(GameStateFlags::tileManagerLoaded) && !isEditorMode())
         {
             auto ticks = ScenarioManager::getScenarioTicks();
@@ -17,5 +17,13 @@ namespace OpenLoco::TownManager
     void updateMonthly();
     Town* updateTownInfo(const World::Pos2& loc, uint32_t population, uint32_t populationCapacity, int16_t rating, int16_t numBuildings);
     void resetBuildingsInfluence();
+    // The tiles with town buildings on them are remembered so resetBuildingsInfluence does not have to
+    // scan the whole map. Any tile a building is created on must be registered, the registry is
+    // rebuilt from a full scan whenever the map itself is replaced.
+    void registerBuilding(const World::Pos2& loc);
+    void invalidateBuildingRegistry();
+    // Logs and returns false if a scan of the map finds a building that has not been registered,
+    // a registry that has not been built since it was invalidated always matches.
+    bool verifyBuildingRegistry();
     void registerHooks();
 }
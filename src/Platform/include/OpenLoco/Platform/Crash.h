@@ -10,6 +10,8 @@ namespace OpenLoco::CrashHandler
     {
         std::string name;
         std::string version;
+        // Called before anything else once a crash has been caught, e.g. to flush the logs.
+        void (*onCrash)() = nullptr;
     };
 
     Handle init(const AppInfo& appInfo);
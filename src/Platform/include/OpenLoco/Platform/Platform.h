@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -22,4 +24,28 @@ namespace OpenLoco::Platform
     bool hasTerminalVT100Support();
     bool enableVT100TerminalMode();
     std::vector<std::string> getCmdLineVector(int argc, const char** argv);
+
+    // A whole file mapped copy-on-write. Pages are only read from disk when first accessed and
+    // writes stay private to the process.
+    class MappedFile
+    {
+    private:
+        std::byte* _data = nullptr;
+        size_t _size = 0;
+
+    public:
+        MappedFile() = default;
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        ~MappedFile();
+
+        // Returns false if the file could not be mapped (this includes empty files)
+        bool open(const fs::path& path);
+        void close();
+
+        std::span<std::byte> data() const
+        {
+            return { _data, _size };
+        }
+    };
 }
@@ -19,6 +19,11 @@ namespace OpenLoco::CrashHandler
         [[maybe_unused]] MDRawAssertionInfo* assertion,
         bool succeeded)
     {
+        if (_appInfo.onCrash != nullptr)
+        {
+            _appInfo.onCrash();
+        }
+
         if (!succeeded)
         {
             constexpr const char* dumpFailedMessage = "Failed to create the dump. Please file an issue with OpenLoco on GitHub and "
@@ -3,9 +3,13 @@
 #include "Platform.h"
 #include <cstdlib>
 #include <cstring>
+#include <fcntl.h>
 #include <iostream>
 #include <pwd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
 
 #ifdef __linux__
 #include <linux/limits.h>
@@ -166,6 +170,52 @@ namespace OpenLoco::Platform
         }
         return argvStrs;
     }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    bool MappedFile::open(const fs::path& path)
+    {
+        close();
+
+        const auto fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+        {
+            return false;
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || fileStat.st_size <= 0)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        const auto size = static_cast<size_t>(fileStat.st_size);
+        auto* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        // The mapping keeps its own reference to the file
+        ::close(fd);
+        if (data == MAP_FAILED)
+        {
+            return false;
+        }
+
+        _data = static_cast<std::byte*>(data);
+        _size = size;
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            munmap(_data, _size);
+            _data = nullptr;
+            _size = 0;
+        }
+    }
 }
 
 #endif
@@ -274,6 +274,58 @@ namespace OpenLoco::Platform
         LocalFree(reinterpret_cast<HLOCAL>(argw));
         return argvStrs;
     }
+
+    MappedFile::~MappedFile()
+    {
+        close();
+    }
+
+    bool MappedFile::open(const fs::path& path)
+    {
+        close();
+
+        auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0 || static_cast<uint64_t>(fileSize.QuadPart) > SIZE_MAX)
+        {
+            CloseHandle(file);
+            return false;
+        }
+
+        auto mapping = CreateFileMappingW(file, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (mapping == nullptr)
+        {
+            return false;
+        }
+
+        // The view keeps its own reference to the mapping
+        auto* data = MapViewOfFile(mapping, FILE_MAP_COPY, 0, 0, 0);
+        CloseHandle(mapping);
+        if (data == nullptr)
+        {
+            return false;
+        }
+
+        _data = static_cast<std::byte*>(data);
+        _size = static_cast<size_t>(fileSize.QuadPart);
+        return true;
+    }
+
+    void MappedFile::close()
+    {
+        if (_data != nullptr)
+        {
+            UnmapViewOfFile(_data);
+            _data = nullptr;
+            _size = 0;
+        }
+    }
 }
 
 #endif